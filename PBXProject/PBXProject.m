@@ -45,6 +45,7 @@ static NSError *makePBXError(NSString *format, ...) {
 @property(nonatomic, weak, readwrite) PBXNode *parent;
 @property(nonatomic, weak, readwrite) PBXProject *project;
 - (BOOL)isValid:(NSError **)error;
+- (NSString *)buildPathWithParentBuildPath:(NSString *)parentBuildPath;
 @end
 
 @interface PBXFileReference ()
@@ -102,7 +103,10 @@ static NSError *makePBXError(NSString *format, ...) {
 @property(nonatomic, strong, readwrite) NSString *pbxFilePath;
 
 @property(nonatomic, strong, readwrite) NSDictionary *fallbackEnvironment;
+// PBXNode -> build path or NSNull, nil if not built yet
+@property(nonatomic, strong, readwrite) NSMapTable *nodeBuildPaths;
 
+- (NSString *)buildPathForNode:(PBXNode *)node;
 - (NSDictionary *)buildFallbackEnvironmentWithTarget:(PBXNativeTarget *)target
                                   buildConfiguration:(XCBuildConfiguration *)buildConfiguration;
 
@@ -111,10 +115,10 @@ static NSError *makePBXError(NSString *format, ...) {
 
 @implementation PBXNode
 
-- (NSString *)buildPath {
+- (NSString *)buildPathWithParentBuildPath:(NSString *)parentBuildPath {
     NSString *absPath = nil;
     if ([self.sourceTree isEqualToString:@"<group>"]) {
-        absPath = [self.parent buildPath];
+        absPath = parentBuildPath;
     } else {
         absPath = [self.project pathForSourceTree:self.sourceTree].stringByStandardizingPath;
     }
@@ -126,6 +130,10 @@ static NSError *makePBXError(NSString *format, ...) {
     return absPath;
 }
 
+- (NSString *)buildPath {
+    return [self.project buildPathForNode:self];
+}
+
 - (BOOL)isValid:(NSError **)error {
     // self.path can be nil
     return ((self.path == nil || [self.path isKindOfClass:[NSString class]]) &&
@@ -664,6 +672,8 @@ static NSError *makePBXError(NSString *format, ...) {
             buildConfiguration:(XCBuildConfiguration *)buildConfiguration
                          error:(NSError **)error {
     self.environment = environment;
+    // build paths depend on environment, rebuilt on next lookup
+    self.nodeBuildPaths = nil;
     self.fallbackEnvironment = [self buildFallbackEnvironmentWithTarget:nativeTarget
                                                      buildConfiguration:buildConfiguration];
 
@@ -700,6 +710,34 @@ static NSError *makePBXError(NSString *format, ...) {
     return [self pathForSourceTree:@"SOURCE_ROOT"];
 }
 
+- (void)addNodeBuildPathsForNode:(PBXNode *)node parentBuildPath:(NSString *)parentBuildPath {
+    NSString *buildPath = [node buildPathWithParentBuildPath:parentBuildPath];
+    [self.nodeBuildPaths setObject:buildPath ?: [NSNull null] forKey:node];
+
+    if ([node isKindOfClass:[PBXGroup class]]) {
+        for (PBXNode *child in ((PBXGroup *)node).children) {
+            [self addNodeBuildPathsForNode:child parentBuildPath:buildPath];
+        }
+    }
+}
+
+// resolve paths for the whole group tree top-down once instead of each node
+// walking up through its parents on every lookup
+- (NSString *)buildPathForNode:(PBXNode *)node {
+    if (self.nodeBuildPaths == nil) {
+        self.nodeBuildPaths = [NSMapTable strongToStrongObjectsMapTable];
+        [self addNodeBuildPathsForNode:self.mainGroup parentBuildPath:[self buildPath]];
+    }
+
+    id buildPath = [self.nodeBuildPaths objectForKey:node];
+    if (buildPath == nil) {
+        // not part of main group tree
+        return [node buildPathWithParentBuildPath:[node.parent buildPath]];
+    }
+
+    return buildPath == [NSNull null] ? nil : buildPath;
+}
+
 - (BOOL)isValid:(NSError **)error {
     if (!(self.buildConfigurationList &&
           [self.buildConfigurationList isKindOfClass:[XCConfigurationList class]] &&
@@ -52,9 +52,16 @@
  * file not found ignores "root" config file
  * recursive include is ignored and causes no error
  *
+ * Files are tokenized byte by byte from a mapped buffer into a flat table
+ * of pairs and includes. Tables are cached by standardized path and
+ * modification time so files included by many files, configurations or
+ * projects are only read and parsed once per process.
+ *
  */
 
+
 #import "XCConfigParser.h"
+#include <sys/stat.h>
 
 NSString * const XCConfigParserErrorDomain = @"XCConfigParserErrorDomain";
 NSString * const XCConfigParserCharacterLocationKey = @"XCConfigParserCharacterLocationKey";
@@ -64,7 +71,6 @@ NSString * const XCConfigParserLineNumberKey = @"XCConfigParserLineNumberKey";
 static NSUInteger const XCConfigParserMaxIncludeDepth = 30;
 
 typedef enum {
-    XCConfigParserTokenTypeComment,
     XCConfigParserTokenTypeHashName,
     XCConfigParserTokenTypeName,
     XCConfigParserTokenTypeQuotedString,
@@ -72,65 +78,139 @@ typedef enum {
     XCConfigParserTokenTypeString
 } XCConfigParserTokenType;
 
-@interface XCConfigParserToken : NSObject
-@property(nonatomic, assign, readwrite) XCConfigParserTokenType tokenType;
-@property(nonatomic, assign, readwrite) NSRange range;
-@end
+typedef struct {
+    XCConfigParserTokenType tokenType;
+    NSUInteger location;
+    NSUInteger length;
+} XCConfigParserToken;
+
+typedef struct {
+    XCConfigParserToken *tokens;
+    NSUInteger count;
+    NSUInteger capacity;
+} XCConfigParserTokenList;
+
+static void addToken(XCConfigParserTokenList *list,
+                     XCConfigParserTokenType tokenType,
+                     NSUInteger location,
+                     NSUInteger length) {
+    if (list->count == list->capacity) {
+        list->capacity = MAX((NSUInteger)64, list->capacity * 2);
+        list->tokens = realloc(list->tokens, list->capacity * sizeof(XCConfigParserToken));
+    }
 
-@implementation XCConfigParserToken
-@end
+    list->tokens[list->count++] = (XCConfigParserToken){tokenType, location, length};
+}
+
+// character at byte location i and its length in bytes. invalid UTF-8 is
+// read as Latin-1 one byte at a time
+NS_INLINE UTF32Char characterAtByteLocation(const uint8_t *bytes,
+                                            NSUInteger length,
+                                            NSUInteger i,
+                                            NSUInteger *byteLength) {
+    uint8_t c = bytes[i];
+    NSUInteger n = (c >= 0xf0 ? 4 : c >= 0xe0 ? 3 : c >= 0xc0 ? 2 : 1);
+    *byteLength = 1;
+    if (n == 1 || c >= 0xf8 || i + n > length) {
+        return c;
+    }
 
-static XCConfigParserToken *makeXCConfigParserToken(XCConfigParserTokenType tokenType,
-                                                    NSUInteger location,
-                                                    NSUInteger length) {
-    XCConfigParserToken *token = [[XCConfigParserToken alloc] init];
-    token.tokenType = tokenType;
-    token.range = NSMakeRange(location, length);
+    UTF32Char character = c & (0x3f >> (n - 1));
+    for (NSUInteger j = 1; j < n; j++) {
+        if ((bytes[i+j] & 0xc0) != 0x80) {
+            return c;
+        }
+        character = (character << 6) | (bytes[i+j] & 0x3f);
+    }
+    *byteLength = n;
 
-    return token;
+    return character;
 }
 
-@interface XCConfigParserStatement : NSObject
-@property(nonatomic, assign, readwrite) NSRange range;
-@end
+// same as the alphanumeric and whitespace character sets the tokenizer used
+// when it worked on NSString, only non-ASCII characters are looked up
+static BOOL isNonASCIICharacterInSet(UTF32Char c, BOOL whitespace) {
+    static NSCharacterSet *nameSet = nil;
+    static NSCharacterSet *whitespaceSet = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        nameSet = [NSCharacterSet alphanumericCharacterSet];
+        whitespaceSet = [NSCharacterSet whitespaceAndNewlineCharacterSet];
+    });
+
+    // characters outside the BMP were surrogate pairs which are in neither set
+    return c <= 0xffff && [whitespace ? whitespaceSet : nameSet characterIsMember:(unichar)c];
+}
 
-@implementation XCConfigParserStatement
-@end
+NS_INLINE BOOL isNameCharacter(UTF32Char c) {
+    if (c >= 0x80) {
+        return isNonASCIICharacterInSet(c, NO);
+    }
 
-@interface XCConfigParserStatementPair : XCConfigParserStatement
-@property(nonatomic, copy, readwrite) NSString *key;
-@property(nonatomic, copy, readwrite) NSString *value;
-@end
+    return ((c >= 'a' && c <= 'z') ||
+            (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9') ||
+            c == '_');
+}
 
-@implementation XCConfigParserStatementPair
-@end
+NS_INLINE BOOL isWhitespaceCharacter(UTF32Char c) {
+    if (c >= 0x80) {
+        return isNonASCIICharacterInSet(c, YES);
+    }
 
-@interface XCConfigParserStatementInclude : XCConfigParserStatement
-@property(nonatomic, copy, readwrite) NSString *path;
-@end
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
 
-@implementation XCConfigParserStatementInclude
-@end
+static NSString *stringFromBytes(const uint8_t *bytes, NSRange range) {
+    return ([[NSString alloc] initWithBytes:bytes + range.location
+                                     length:range.length
+                                   encoding:NSUTF8StringEncoding] ?:
+            [[NSString alloc] initWithBytes:bytes + range.location
+                                     length:range.length
+                                   encoding:NSISOLatin1StringEncoding]);
+}
+
+// character location and 1-based line number for a byte location. lines
+// end like for NSStringEnumerationByLines, CR, LF, CRLF, NEL, LS and PS
+static void locationFromByteLocation(const uint8_t *bytes,
+                                     NSUInteger byteLocation,
+                                     NSUInteger *characterLocation,
+                                     NSUInteger *lineNumber) {
+    NSUInteger characters = 0;
+    NSUInteger lines = 1;
+
+    for (NSUInteger i = 0; i < byteLocation; i++) {
+        uint8_t c = bytes[i];
+        // byteLocation is inside the buffer so there is a byte after CR
+        if (c == '\n' ||
+            (c == '\r' && bytes[i+1] != '\n') ||
+            (c == 0x85 && i >= 1 && bytes[i-1] == 0xc2) ||
+            ((c == 0xa8 || c == 0xa9) && i >= 2 &&
+             bytes[i-2] == 0xe2 && bytes[i-1] == 0x80)) {
+            lines++;
+        }
+        // skip UTF-8 continuation bytes, 4 byte sequences are surrogate pairs
+        if (c < 0x80 || c >= 0xc0) {
+            characters += c >= 0xf0 ? 2 : 1;
+        }
+    }
+
+    *characterLocation = characters;
+    *lineNumber = lines;
+}
 
-static NSUInteger lineNumberFromLocation(NSString *string, NSUInteger location) {
-    __block NSUInteger lineNumber = 0;
-
-    [string
-     enumerateSubstringsInRange:NSMakeRange(0, string.length)
-     options:NSStringEnumerationByLines
-     usingBlock:^(NSString *substring,
-                  NSRange substringRange,
-                  NSRange enclosingRange,
-                  BOOL *stop) {
-         *stop = NSLocationInRange(location, enclosingRange);
-         lineNumber++;
-     }];
-
-    return lineNumber;
+static NSError *makeParserErrorWithLocation(NSUInteger characterLocation,
+                                            NSUInteger lineNumber,
+                                            NSString *description) {
+    return [NSError errorWithDomain:XCConfigParserErrorDomain
+                               code:0
+                           userInfo:@{NSLocalizedDescriptionKey: description,
+                                      XCConfigParserCharacterLocationKey: @(characterLocation),
+                                      XCConfigParserLineNumberKey: @(lineNumber)}];
 }
 
-static NSError *makeParserError(NSString *string,
-                                NSUInteger location,
+static NSError *makeParserError(const uint8_t *bytes,
+                                NSUInteger byteLocation,
                                 NSString *format, ...) {
     va_list ap;
     va_start(ap, format);
@@ -138,26 +218,79 @@ static NSError *makeParserError(NSString *string,
                              initWithFormat:format arguments:ap];
     va_end(ap);
 
-    return [NSError errorWithDomain:XCConfigParserErrorDomain
-                               code:0
-                           userInfo:@{NSLocalizedDescriptionKey: description,
-                                      XCConfigParserCharacterLocationKey: @(location),
-                                      XCConfigParserLineNumberKey: @(lineNumberFromLocation(string, location))}];
+    NSUInteger characterLocation = 0;
+    NSUInteger lineNumber = 0;
+    locationFromByteLocation(bytes, byteLocation, &characterLocation, &lineNumber);
+
+    return makeParserErrorWithLocation(characterLocation, lineNumber, description);
 }
 
+// strip UTF-8 BOM and convert UTF-16 to UTF-8 so the tokenizer can work on
+// ASCII compatible bytes
+static NSData *asciiCompatibleData(NSData *data) {
+    const uint8_t *bytes = data.bytes;
+    NSUInteger length = data.length;
+
+    if (length >= 3 && bytes[0] == 0xef && bytes[1] == 0xbb && bytes[2] == 0xbf) {
+        return [data subdataWithRange:NSMakeRange(3, length - 3)];
+    } else if (length >= 2 &&
+               ((bytes[0] == 0xff && bytes[1] == 0xfe) ||
+                (bytes[0] == 0xfe && bytes[1] == 0xff))) {
+        NSString *string = [[NSString alloc] initWithData:data
+                                                 encoding:NSUnicodeStringEncoding];
+        return [string dataUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    return data;
+}
+
+// pairs and includes of one file in order
+@interface XCConfigParserTable : NSObject
+// key for pairs, NSNull for includes
+@property(nonatomic, strong, readwrite) NSMutableArray *keys;
+// value for pairs, path for includes
+@property(nonatomic, strong, readwrite) NSMutableArray *values;
+// @[character location, line number] for includes, NSNull for pairs
+@property(nonatomic, strong, readwrite) NSMutableArray *locations;
+@property(nonatomic, assign, readwrite) struct timespec modificationTime;
+@property(nonatomic, assign, readwrite) off_t size;
+@end
+
+@implementation XCConfigParserTable
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.keys = [NSMutableArray array];
+    self.values = [NSMutableArray array];
+    self.locations = [NSMutableArray array];
+
+    return self;
+}
+
+@end
+
 @interface XCConfigParser ()
-+ (NSArray *)_tokenizeString:(NSString *)string
-                       error:(NSError **)error;
++ (BOOL)_tokenizeBytes:(const uint8_t *)bytes
+                length:(NSUInteger)length
+                tokens:(XCConfigParserTokenList *)tokens
+                 error:(NSError **)error;
 
-+ (NSArray *)_parseTokens:(NSArray *)tokens
-                   string:(NSString *)string
-                    error:(NSError **)error;
++ (XCConfigParserTable *)_tableFromBytes:(const uint8_t *)bytes
+                                  length:(NSUInteger)length
+                                   error:(NSError **)error;
 
-+ (NSDictionary *)_dictionaryFromString:(NSString *)string
-                        maxIncludeDepth:(NSUInteger)maxIncludeDepth
-                        includeBasePath:(NSString *)includeBasePath
++ (XCConfigParserTable *)_tableFromFile:(NSString *)file
                                   error:(NSError **)error;
 
++ (NSDictionary *)_dictionaryFromTable:(XCConfigParserTable *)table
+                       maxIncludeDepth:(NSUInteger)maxIncludeDepth
+                       includeBasePath:(NSString *)includeBasePath
+                                 error:(NSError **)error;
+
 + (NSDictionary *)_dictionaryFromFile:(NSString *)file
                       maxIncludeDepth:(NSUInteger)maxIncludeDepth
                                 error:(NSError **)error;
@@ -165,8 +298,10 @@ static NSError *makeParserError(NSString *string,
 
 @implementation XCConfigParser
 
-+ (NSArray *)_tokenizeString:(NSString *)string
-                       error:(NSError **)error {
++ (BOOL)_tokenizeBytes:(const uint8_t *)bytes
+                length:(NSUInteger)length
+                tokens:(XCConfigParserTokenList *)tokens
+                 error:(NSError **)error {
     enum {
         TokenizeStateWhitespace,
         TokenizeStateComment,
@@ -175,107 +310,82 @@ static NSError *makeParserError(NSString *string,
         TokenizeStateName,
         TokenizeStateStringToCommentOrEndOfLine,
     } tokenizeState = TokenizeStateWhitespace;
-    NSMutableArray *tokens = [NSMutableArray array];
-    NSCharacterSet *whitespaceSet = [NSCharacterSet whitespaceAndNewlineCharacterSet];
-    NSMutableCharacterSet *nameSet = [NSMutableCharacterSet alphanumericCharacterSet];
-    [nameSet addCharactersInString:@"_"]; // hmm
-    NSUInteger length = string.length;
 
     NSUInteger i = 0;
     NSUInteger tokenLocation = i;
 
     while (i < length) {
-        unichar c  = [string characterAtIndex:i];
-        unichar c1  = i < (length-1) ? [string characterAtIndex:i+1] : 0;
+        // characters are decoded so non-ASCII names and whitespace work as
+        // before, all syntax characters are ASCII
+        NSUInteger n = 1;
+        NSUInteger n1 = 1;
+        UTF32Char c = characterAtByteLocation(bytes, length, i, &n);
+        UTF32Char c1 = i+n < length ? characterAtByteLocation(bytes, length, i+n, &n1) : 0;
 
         if (tokenizeState == TokenizeStateWhitespace) {
             if (c == '=') {
-                [tokens addObject:
-                 makeXCConfigParserToken(XCConfigParserTokenTypeEquals, i, 1)];
+                addToken(tokens, XCConfigParserTokenTypeEquals, i, 1);
                 i++; // =
                 tokenLocation = i;
                 tokenizeState = TokenizeStateStringToCommentOrEndOfLine;
-            } else if (c  == '#') {
+            } else if (c == '#') {
                 tokenLocation = i;
                 tokenizeState = TokenizeStateHashName;
-            } else if (c  == '"') {
+            } else if (c == '"') {
                 tokenLocation = i;
                 tokenizeState = TokenizeStateQuotedString;
                 i++; // skip "
-            } else if (c  == '/' && c1 == '/') {
-                tokenLocation = i;
+            } else if (c == '/' && c1 == '/') {
                 tokenizeState = TokenizeStateComment;
                 i += 2; // skip //
-            } else if ([nameSet characterIsMember:c]) {
+            } else if (isNameCharacter(c)) {
                 tokenLocation = i;
                 tokenizeState = TokenizeStateName;
-            } else if ([whitespaceSet characterIsMember:c]) {
-                i++; // skip whitespace
+            } else if (isWhitespaceCharacter(c)) {
+                i += n; // skip whitespace
             } else {
-                *error = makeParserError(string, i, @"Unexpected character \"%C\"", c);
-                return nil;
+                *error = makeParserError(bytes, i, @"Unexpected character \"%@\"",
+                                         stringFromBytes(bytes, NSMakeRange(i, n)));
+                return NO;
             }
         } else if (tokenizeState == TokenizeStateComment) {
+            // comments are not needed by the parser so no token
             if (c == '\n') {
-                [tokens addObject:
-                 makeXCConfigParserToken(XCConfigParserTokenTypeComment,
-                                         tokenLocation, i - tokenLocation)];
                 tokenizeState = TokenizeStateWhitespace;
-            } else {
-                // char in comment
             }
-            i++;
-        } else if (tokenizeState == TokenizeStateName) {
-            if ([nameSet characterIsMember:c] &&
-                ![nameSet characterIsMember:c1]) {
-                [tokens addObject:
-                 // +1 to include current char also
-                 makeXCConfigParserToken(XCConfigParserTokenTypeName,
-                                         tokenLocation, i+1 - tokenLocation)];
+            i += n;
+        } else if (tokenizeState == TokenizeStateName ||
+                   tokenizeState == TokenizeStateHashName) {
+            if (isNameCharacter(c) && !isNameCharacter(c1)) {
+                // +n to include current char also
+                addToken(tokens,
+                         (tokenizeState == TokenizeStateName ?
+                          XCConfigParserTokenTypeName :
+                          XCConfigParserTokenTypeHashName),
+                         tokenLocation, i+n - tokenLocation);
                 tokenizeState = TokenizeStateWhitespace;
-            } else {
-                // char in ident
             }
-            i++;
-        } else if (tokenizeState == TokenizeStateHashName) {
-            if ([nameSet characterIsMember:c] &&
-                ![nameSet characterIsMember:c1]) {
-                [tokens addObject:
-                 // +1 to include current char also
-                 makeXCConfigParserToken(XCConfigParserTokenTypeHashName,
-                                         tokenLocation, i+1 - tokenLocation)];
-                tokenizeState = TokenizeStateWhitespace;
-            } else {
-                // char in ident
-            }
-            i++;
+            i += n;
         } else if (tokenizeState == TokenizeStateQuotedString) {
             if (c == '"') {
-                [tokens addObject:
-                 // +1 to include current char also
-                 makeXCConfigParserToken(XCConfigParserTokenTypeQuotedString,
-                                         tokenLocation, i+1 - tokenLocation)];
+                // +1 to include current char also
+                addToken(tokens, XCConfigParserTokenTypeQuotedString,
+                         tokenLocation, i+1 - tokenLocation);
                 tokenizeState = TokenizeStateWhitespace;
-            } else {
-                // char in string until end if line
             }
-            i++;
+            i += n;
         } else if (tokenizeState == TokenizeStateStringToCommentOrEndOfLine) {
             if (c == '/' && c1 == '/') {
-                [tokens addObject:
-                 makeXCConfigParserToken(XCConfigParserTokenTypeString,
-                                         tokenLocation, i - tokenLocation)];
+                addToken(tokens, XCConfigParserTokenTypeString,
+                         tokenLocation, i - tokenLocation);
                 tokenizeState = TokenizeStateComment;
                 i++;
             } else if (c == '\n') {
-                [tokens addObject:
-                 makeXCConfigParserToken(XCConfigParserTokenTypeString,
-                                         tokenLocation, i - tokenLocation)];
+                addToken(tokens, XCConfigParserTokenTypeString,
+                         tokenLocation, i - tokenLocation);
                 tokenizeState = TokenizeStateWhitespace;
-            } else {
-                // char in string until comment or end of line
             }
-            i++;
+            i += n;
         } else {
             NSAssert(NO, nil);
         }
@@ -283,144 +393,201 @@ static NSError *makeParserError(NSString *string,
 
     // at end we should be in whitespace state
     if (tokenizeState != TokenizeStateWhitespace) {
-        *error = makeParserError(string, length-1, @"Unexpected end");
-        return nil;
+        *error = makeParserError(bytes, length-1, @"Unexpected end");
+        return NO;
     }
 
-    return tokens;
+    return YES;
 }
 
-+ (NSArray *)_parseTokens:(NSArray *)tokens
-                   string:(NSString *)string
-                    error:(NSError **)error {
-    NSMutableArray *statements = [NSMutableArray array];
-
-    // filter out comment tokens
-    NSMutableArray *filteredTokens = [NSMutableArray array];
-    for (XCConfigParserToken *token in tokens) {
-        if (token.tokenType == XCConfigParserTokenTypeComment) {
-            continue;
-        }
-
-        [filteredTokens addObject:token];
++ (XCConfigParserTable *)_tableFromBytes:(const uint8_t *)bytes
+                                  length:(NSUInteger)length
+                                   error:(NSError **)error {
+    XCConfigParserTokenList tokenList = {NULL, 0, 0};
+    if (![self _tokenizeBytes:bytes length:length tokens:&tokenList error:error]) {
+        free(tokenList.tokens);
+        return nil;
     }
 
-    NSUInteger tokensCount = filteredTokens.count;
+    XCConfigParserTable *table = [[XCConfigParserTable alloc] init];
+    XCConfigParserToken *tokens = tokenList.tokens;
+    NSUInteger tokensCount = tokenList.count;
+
     for (NSUInteger i = 0; i < tokensCount; ) {
-        XCConfigParserToken *token1 = filteredTokens[i];
-        XCConfigParserToken *token2 = (i+1 < tokensCount ?
-                                       filteredTokens[i+1] : nil);
-        XCConfigParserToken *token3 = (i+2 < tokensCount ?
-                                       filteredTokens[i+2] : nil);
-
-        if (token1.tokenType == XCConfigParserTokenTypeName &&
-            token2 != nil &&
-            token2.tokenType == XCConfigParserTokenTypeEquals &&
-            token3 != nil &&
-            token3.tokenType == XCConfigParserTokenTypeString) {
+        XCConfigParserToken *token1 = &tokens[i];
+        XCConfigParserToken *token2 = (i+1 < tokensCount ? &tokens[i+1] : NULL);
+        XCConfigParserToken *token3 = (i+2 < tokensCount ? &tokens[i+2] : NULL);
+
+        if (token1->tokenType == XCConfigParserTokenTypeName &&
+            token2 != NULL &&
+            token2->tokenType == XCConfigParserTokenTypeEquals &&
+            token3 != NULL &&
+            token3->tokenType == XCConfigParserTokenTypeString) {
 
             // name = value
 
-            XCConfigParserStatementPair *pair = [[XCConfigParserStatementPair alloc] init];
-            pair.range = NSMakeRange(token1.range.location,
-                                     NSMaxRange(token3.range) -
-                                     token1.range.location);
-            pair.key = [string substringWithRange:token1.range];
-            pair.value = [[string substringWithRange:token3.range]
-                          stringByTrimmingCharactersInSet:
-                          [NSCharacterSet whitespaceCharacterSet]];
+            NSRange valueRange = NSMakeRange(token3->location, token3->length);
+            // trim spaces and tabs without creating a string
+            while (valueRange.length > 0 &&
+                   (bytes[valueRange.location] == ' ' ||
+                    bytes[valueRange.location] == '\t')) {
+                valueRange.location++;
+                valueRange.length--;
+            }
+            while (valueRange.length > 0 &&
+                   (bytes[NSMaxRange(valueRange)-1] == ' ' ||
+                    bytes[NSMaxRange(valueRange)-1] == '\t')) {
+                valueRange.length--;
+            }
 
-            [statements addObject:pair];
+            NSString *value = stringFromBytes(bytes, valueRange);
+            // non-ASCII spaces like no-break space are trimmed too
+            if (valueRange.length > 0 &&
+                (bytes[valueRange.location] >= 0x80 ||
+                 bytes[NSMaxRange(valueRange)-1] >= 0x80)) {
+                value = [value stringByTrimmingCharactersInSet:
+                         [NSCharacterSet whitespaceCharacterSet]];
+            }
+
+            [table.keys addObject:stringFromBytes(bytes, NSMakeRange(token1->location,
+                                                                     token1->length))];
+            [table.values addObject:value];
+            [table.locations addObject:[NSNull null]];
 
             i += 3;
-        } else if (token1.tokenType == XCConfigParserTokenTypeHashName &&
-                   token2 != nil &&
-                   token2.tokenType == XCConfigParserTokenTypeQuotedString) {
+        } else if (token1->tokenType == XCConfigParserTokenTypeHashName &&
+                   token2 != NULL &&
+                   token2->tokenType == XCConfigParserTokenTypeQuotedString) {
 
             // #directive "argument"
 
-            NSString *directive = [string substringWithRange:token1.range];
-            NSString *token2String = [string substringWithRange:token2.range];
-            NSString *argument = [token2String substringWithRange:
-                                  NSMakeRange(1, token2String.length-2)];
-            NSRange range = NSMakeRange(token1.range.location,
-                                        NSMaxRange(token2.range) -
-                                        token1.range.location);
-
-            if ([directive isEqualToString:@"#include"]) {
-                XCConfigParserStatementInclude *include = [[XCConfigParserStatementInclude alloc] init];
-                include.range = range;
-                include.path = argument;
-                [statements addObject:include];
-            } else {
-                *error = makeParserError(string, token1.range.location,
-                                         @"Unknown directive %@", directive);
+            if (token1->length != 8 || memcmp(bytes + token1->location, "#include", 8) != 0) {
+                *error = makeParserError(bytes, token1->location,
+                                         @"Unknown directive %@",
+                                         stringFromBytes(bytes, NSMakeRange(token1->location,
+                                                                            token1->length)));
+                free(tokens);
                 return nil;
             }
 
+            NSUInteger characterLocation = 0;
+            NSUInteger lineNumber = 0;
+            locationFromByteLocation(bytes, token1->location, &characterLocation, &lineNumber);
+
+            [table.keys addObject:[NSNull null]];
+            // without quotes
+            [table.values addObject:stringFromBytes(bytes, NSMakeRange(token2->location+1,
+                                                                       token2->length-2))];
+            [table.locations addObject:@[@(characterLocation), @(lineNumber)]];
+
             i += 2;
         } else {
-            *error = makeParserError(string, token1.range.location,
+            *error = makeParserError(bytes, token1->location,
                                      @"Parse error around %@",
-                                     [string substringWithRange:token1.range]);
+                                     stringFromBytes(bytes, NSMakeRange(token1->location,
+                                                                        token1->length)));
+            free(tokens);
             return nil;
         }
     }
+    free(tokens);
 
-    return statements;
+    return table;
 }
 
-+ (NSDictionary *)_dictionaryFromString:(NSString *)string
-                        maxIncludeDepth:(NSUInteger)maxIncludeDepth
-                        includeBasePath:(NSString *)includeBasePath
++ (XCConfigParserTable *)_tableFromFile:(NSString *)file
                                   error:(NSError **)error {
-    NSArray *tokens = [self _tokenizeString:string error:error];
-    if (tokens == nil) {
+    static NSMutableDictionary *tableCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        tableCache = [NSMutableDictionary dictionary];
+    });
+
+    struct stat st;
+    BOOL hasStat = stat(file.fileSystemRepresentation, &st) == 0;
+    if (hasStat) {
+        @synchronized(tableCache) {
+            XCConfigParserTable *table = tableCache[file];
+            if (table != nil &&
+                table.size == st.st_size &&
+                table.modificationTime.tv_sec == st.st_mtimespec.tv_sec &&
+                table.modificationTime.tv_nsec == st.st_mtimespec.tv_nsec) {
+                return table;
+            }
+        }
+    }
+
+    NSData *data = [NSData dataWithContentsOfFile:file
+                                          options:NSDataReadingMappedIfSafe
+                                            error:error];
+    if (data == nil) {
         return nil;
     }
+    data = asciiCompatibleData(data);
 
-    NSArray *statements = [self _parseTokens:tokens string:string error:error];
-    if (statements == nil) {
+    XCConfigParserTable *table = [self _tableFromBytes:data.bytes
+                                                length:data.length
+                                                 error:error];
+    if (table == nil) {
         return nil;
     }
 
-    NSMutableDictionary *configDictionary = [NSMutableDictionary dictionary];
-    for (XCConfigParserStatement *statement in statements) {
-        if ([statement isKindOfClass:[XCConfigParserStatementPair class]]) {
-            XCConfigParserStatementPair *pair = (id)statement;
-            configDictionary[pair.key] = pair.value;
-        } else if ([statement isKindOfClass:[XCConfigParserStatementInclude class]]) {
-            XCConfigParserStatementInclude *include = (id)statement;
-
-            if (maxIncludeDepth == 0) {
-                // probably recursive include, Xcode does not give any
-                // error so just ignore the include and continue
-                continue;
-            }
+    if (hasStat) {
+        table.size = st.st_size;
+        table.modificationTime = st.st_mtimespec;
+        @synchronized(tableCache) {
+            tableCache[file] = table;
+        }
+    }
 
-            NSString *includeFile = [includeBasePath
-                                     stringByAppendingPathComponent:include.path].stringByStandardizingPath;
-            NSDictionary *includeConfigDictionary = [self
-                                                     _dictionaryFromFile:includeFile
-                                                     maxIncludeDepth:maxIncludeDepth-1
-                                                     error:error];
-            if (includeConfigDictionary == nil) {
-                if ([(*error).domain isEqualToString:XCConfigParserErrorDomain]) {
-                    // pass along error
-                } else {
-                    *error = makeParserError(string, include.range.location,
-                                             @"Failed to include %@: %@",
-                                             include.path, (*error).localizedDescription);
-                }
+    return table;
+}
 
-                return nil;
-            }
++ (NSDictionary *)_dictionaryFromTable:(XCConfigParserTable *)table
+                       maxIncludeDepth:(NSUInteger)maxIncludeDepth
+                       includeBasePath:(NSString *)includeBasePath
+                                 error:(NSError **)error {
+    NSArray *keys = table.keys;
+    NSArray *values = table.values;
+    NSUInteger count = keys.count;
+    NSMutableDictionary *configDictionary = [NSMutableDictionary dictionaryWithCapacity:count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        id key = keys[i];
+        if (key != [NSNull null]) {
+            configDictionary[key] = values[i];
+            continue;
+        }
 
-            [configDictionary addEntriesFromDictionary:includeConfigDictionary];
+        if (maxIncludeDepth == 0) {
+            // probably recursive include, Xcode does not give any
+            // error so just ignore the include and continue
+            continue;
+        }
 
-        } else {
-            NSAssert(NO, @"");
+        NSString *includePath = values[i];
+        NSString *includeFile = [includeBasePath
+                                 stringByAppendingPathComponent:includePath].stringByStandardizingPath;
+        NSDictionary *includeConfigDictionary = [self
+                                                 _dictionaryFromFile:includeFile
+                                                 maxIncludeDepth:maxIncludeDepth-1
+                                                 error:error];
+        if (includeConfigDictionary == nil) {
+            if ([(*error).domain isEqualToString:XCConfigParserErrorDomain]) {
+                // pass along error
+            } else {
+                NSArray *location = table.locations[i];
+                *error = makeParserErrorWithLocation([location[0] unsignedIntegerValue],
+                                                     [location[1] unsignedIntegerValue],
+                                                     [NSString stringWithFormat:
+                                                      @"Failed to include %@: %@",
+                                                      includePath, (*error).localizedDescription]);
+            }
+
+            return nil;
         }
+
+        [configDictionary addEntriesFromDictionary:includeConfigDictionary];
     }
 
     return configDictionary;
@@ -429,31 +596,45 @@ static NSError *makeParserError(NSString *string,
 + (NSDictionary *)dictionaryFromString:(NSString *)string
                        includeBasePath:(NSString *)includeBasePath
                                  error:(NSError **)error {
-    return [self _dictionaryFromString:string
-                       maxIncludeDepth:XCConfigParserMaxIncludeDepth
-                       includeBasePath:includeBasePath
-                                 error:error ?: &(NSError * __autoreleasing){nil}];
+    error = error ?: &(NSError * __autoreleasing){nil};
+
+    NSData *data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    XCConfigParserTable *table = [self _tableFromBytes:data.bytes
+                                                length:data.length
+                                                 error:error];
+    if (table == nil) {
+        return nil;
+    }
+
+    return [self _dictionaryFromTable:table
+                      maxIncludeDepth:XCConfigParserMaxIncludeDepth
+                      includeBasePath:includeBasePath
+                                error:error];
 }
 
 + (NSDictionary *)_dictionaryFromFile:(NSString *)file
                       maxIncludeDepth:(NSUInteger)maxIncludeDepth
                                 error:(NSError **)error {
-    NSString *string = [NSString stringWithContentsOfFile:file usedEncoding:nil error:error];
-    if (string == nil) {
-        return nil;
-    }
-
     NSString *standardizedFile = file.stringByStandardizingPath;
-    NSString *includeBasePath = standardizedFile.stringByDeletingLastPathComponent;
-    if ([includeBasePath isEqualToString:@""]) {
-        // TODO: can this happen? only if file is not absolute
-        includeBasePath = [NSFileManager defaultManager].currentDirectoryPath;
+    XCConfigParserTable *table = [self _tableFromFile:standardizedFile error:error];
+
+    NSDictionary *configDictionary = nil;
+    if (table != nil) {
+        NSString *includeBasePath = standardizedFile.stringByDeletingLastPathComponent;
+        if ([includeBasePath isEqualToString:@""]) {
+            // TODO: can this happen? only if file is not absolute
+            includeBasePath = [NSFileManager defaultManager].currentDirectoryPath;
+        }
+
+        configDictionary = [self _dictionaryFromTable:table
+                                      maxIncludeDepth:maxIncludeDepth
+                                      includeBasePath:includeBasePath
+                                                error:error];
+    } else if (![(*error).domain isEqualToString:XCConfigParserErrorDomain]) {
+        // failed to read file, passed along as is
+        return nil;
     }
 
-    NSDictionary *configDictionary = [self _dictionaryFromString:string
-                                                 maxIncludeDepth:maxIncludeDepth
-                                                 includeBasePath:includeBasePath
-                                                           error:error];
     if (configDictionary == nil) {
         if ((*error).userInfo[XCConfigParserFileKey] == nil) {
             // no file has been set in error yet, include file key.
@@ -0,0 +1,65 @@
+// Reads a .xcworkspace and the shared schemes of it and its projects.
+//
+// Use +[XCWorkspace workspaceFromPath:...] to read contents.xcworkspacedata,
+// -[XCWorkspace loadProjects:] to read and validate all referenced projects
+// concurrently and -[XCWorkspace buildableReferencesForSchemeNamed:...] to
+// find the project targets built by a scheme.
+//
+// Copyright (c) 2013 <mattias.wadman@gmail.com>
+//
+// MIT License:
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import <Foundation/Foundation.h>
+#import "PBXProject.h"
+
+extern NSString * const XCWorkspaceErrorDomain;
+
+@interface XCSchemeBuildableReference : NSObject
+// absolute path to .xcodeproj
+@property(nonatomic, copy, readonly) NSString *projectPath;
+@property(nonatomic, copy, readonly) NSString *targetName;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithProjectPath:(NSString *)projectPath
+                         targetName:(NSString *)targetName NS_DESIGNATED_INITIALIZER;
+@end
+
+@interface XCWorkspace : NSObject
+// absolute path to .xcworkspace
+@property(nonatomic, copy, readonly) NSString *path;
+// absolute paths to .xcodeproj in workspace order
+@property(nonatomic, copy, readonly) NSArray *projectPaths;
+// project path is key, value is PBXProject, set by loadProjects:
+@property(nonatomic, copy, readonly) NSDictionary *projects;
+
++ (XCWorkspace *)workspaceFromPath:(NSString *)path
+                             error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithPath:(NSString *)path
+                projectPaths:(NSArray *)projectPaths NS_DESIGNATED_INITIALIZER;
+
+- (BOOL)loadProjects:(NSError **)error;
+// shared schemes in workspace and projects
+- (NSArray *)schemeNames;
+// array of XCSchemeBuildableReference
+- (NSArray *)buildableReferencesForSchemeNamed:(NSString *)schemeName
+                                         error:(NSError **)error;
+@end
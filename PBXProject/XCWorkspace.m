@@ -0,0 +1,309 @@
+// Copyright (c) 2013 <mattias.wadman@gmail.com>
+//
+// MIT License:
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#import "XCWorkspace.h"
+#import "NSString+PBXProject.h"
+
+NSString * const XCWorkspaceErrorDomain = @"XCWorkspaceErrorDomain";
+
+static NSError *makeWorkspaceError(NSString *format, ...) {
+    va_list ap;
+    va_start(ap, format);
+    NSString *description = [[NSString alloc]
+                             initWithFormat:format arguments:ap];
+    va_end(ap);
+
+    return [NSError errorWithDomain:XCWorkspaceErrorDomain
+                               code:0
+                           userInfo:@{NSLocalizedDescriptionKey: description}];
+}
+
+// "group:a", "container:a", "absolute:/a" or "self:" to absolute path
+static NSString *resolveLocation(NSString *location,
+                                 NSString *groupPath,
+                                 NSString *containerPath,
+                                 NSString *selfPath) {
+    NSRange colonRange = [location rangeOfString:@":"];
+    if (colonRange.location == NSNotFound) {
+        return nil;
+    }
+
+    NSString *type = [location substringToIndex:colonRange.location];
+    NSString *path = [location substringFromIndex:NSMaxRange(colonRange)];
+
+    if ([type isEqualToString:@"group"]) {
+        return [path pbx_stringByStandardizingAbsolutePath:groupPath];
+    } else if ([type isEqualToString:@"container"]) {
+        return [path pbx_stringByStandardizingAbsolutePath:containerPath];
+    } else if ([type isEqualToString:@"absolute"]) {
+        return path.stringByStandardizingPath;
+    } else if ([type isEqualToString:@"self"]) {
+        return selfPath;
+    }
+
+    return nil;
+}
+
+
+@interface XCSchemeBuildableReference ()
+@property(nonatomic, copy, readwrite) NSString *projectPath;
+@property(nonatomic, copy, readwrite) NSString *targetName;
+@end
+
+@implementation XCSchemeBuildableReference
+
+- (instancetype)initWithProjectPath:(NSString *)projectPath
+                         targetName:(NSString *)targetName {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.projectPath = projectPath;
+    self.targetName = targetName;
+
+    return self;
+}
+
+@end
+
+
+@interface XCWorkspace ()
+@property(nonatomic, copy, readwrite) NSString *path;
+@property(nonatomic, copy, readwrite) NSArray *projectPaths;
+@property(nonatomic, copy, readwrite) NSDictionary *projects;
+@end
+
+@implementation XCWorkspace
+
++ (void)addProjectPathsInElement:(NSXMLElement *)element
+                       groupPath:(NSString *)groupPath
+                   containerPath:(NSString *)containerPath
+                        selfPath:(NSString *)selfPath
+                    projectPaths:(NSMutableArray *)projectPaths {
+    for (NSXMLElement *child in element.children) {
+        if (![child isKindOfClass:[NSXMLElement class]]) {
+            continue;
+        }
+
+        NSString *location = [child attributeForName:@"location"].stringValue;
+        NSString *childPath = (location != nil ?
+                               resolveLocation(location, groupPath,
+                                               containerPath, selfPath) :
+                               nil);
+
+        if ([child.name isEqualToString:@"Group"]) {
+            [self addProjectPathsInElement:child
+                                 groupPath:childPath ?: groupPath
+                             containerPath:containerPath
+                                  selfPath:selfPath
+                              projectPaths:projectPaths];
+        } else if ([child.name isEqualToString:@"FileRef"]) {
+            if ([childPath.pathExtension isEqualToString:@"xcodeproj"] &&
+                ![projectPaths containsObject:childPath]) {
+                [projectPaths addObject:childPath];
+            }
+        }
+    }
+}
+
++ (XCWorkspace *)workspaceFromPath:(NSString *)path
+                             error:(NSError **)error {
+    error = error ?: &(NSError * __autoreleasing){nil};
+
+    path = [path pbx_stringByStandardizingAbsolutePath:
+            [NSFileManager defaultManager].currentDirectoryPath];
+    NSString *contentsPath = [path stringByAppendingPathComponent:
+                              @"contents.xcworkspacedata"];
+    NSData *contents = [NSData dataWithContentsOfFile:contentsPath];
+    if (contents == nil) {
+        *error = makeWorkspaceError(@"Could not open %@", contentsPath);
+        return nil;
+    }
+
+    NSXMLDocument *dom = [[NSXMLDocument alloc] initWithData:contents
+                                                     options:0
+                                                       error:error];
+    if (dom == nil || ![dom.rootElement.name isEqualToString:@"Workspace"]) {
+        *error = *error ?: makeWorkspaceError(@"Invalid workspace %@", contentsPath);
+        return nil;
+    }
+
+    // container is the directory containing the workspace, self is the
+    // project for workspaces embedded in a .xcodeproj
+    NSString *containerPath = path.stringByDeletingLastPathComponent;
+    NSString *selfPath = ([containerPath.pathExtension isEqualToString:@"xcodeproj"] ?
+                          containerPath :
+                          nil);
+    NSMutableArray *projectPaths = [NSMutableArray array];
+    [self addProjectPathsInElement:dom.rootElement
+                         groupPath:containerPath
+                     containerPath:containerPath
+                          selfPath:selfPath
+                      projectPaths:projectPaths];
+
+    return [[XCWorkspace alloc] initWithPath:path projectPaths:projectPaths];
+}
+
+- (instancetype)initWithPath:(NSString *)path
+                projectPaths:(NSArray *)projectPaths {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.path = path;
+    self.projectPaths = projectPaths;
+    self.projects = @{};
+
+    return self;
+}
+
+- (BOOL)loadProjects:(NSError **)error {
+    error = error ?: &(NSError * __autoreleasing){nil};
+
+    NSUInteger count = self.projectPaths.count;
+    // index is project path index, value is PBXProject or NSError
+    NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [results addObject:[NSNull null]];
+    }
+
+    // projects are independent so read and validate them concurrently
+    dispatch_apply(count, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                   ^(size_t i) {
+                       NSError *projectError = nil;
+                       PBXProject *project = [PBXProject pbxProjectFromPath:self.projectPaths[i]
+                                                                      error:&projectError];
+                       @synchronized(results) {
+                           results[i] = project ?: projectError ?: [NSNull null];
+                       }
+                   });
+
+    NSMutableDictionary *loadedProjects = [NSMutableDictionary dictionary];
+    NSError *firstError = nil;
+    for (NSUInteger i = 0; i < count; i++) {
+        id result = results[i];
+        if ([result isKindOfClass:[PBXProject class]]) {
+            loadedProjects[self.projectPaths[i]] = result;
+        } else if (firstError == nil) {
+            firstError = makeWorkspaceError(@"Failed to read %@: %@",
+                                            self.projectPaths[i],
+                                            ([result isKindOfClass:[NSError class]] ?
+                                             [result localizedDescription] :
+                                             @"Invalid PBXProject"));
+        }
+    }
+
+    self.projects = loadedProjects;
+
+    if (firstError != nil) {
+        *error = firstError;
+        return NO;
+    }
+
+    return YES;
+}
+
+// scheme name is key, value is @[scheme path, container path]
+- (NSDictionary *)schemePaths {
+    NSMutableDictionary *schemePaths = [NSMutableDictionary dictionary];
+    NSMutableArray *containers = [NSMutableArray arrayWithObject:self.path];
+    [containers addObjectsFromArray:self.projectPaths];
+
+    for (NSString *container in containers) {
+        NSString *schemesPath = [NSString pathWithComponents:
+                                 @[container, @"xcshareddata", @"xcschemes"]];
+        for (NSString *name in [[NSFileManager defaultManager]
+                                contentsOfDirectoryAtPath:schemesPath error:NULL]) {
+            if (![name.pathExtension isEqualToString:@"xcscheme"]) {
+                continue;
+            }
+
+            NSString *schemeName = name.stringByDeletingPathExtension;
+            // workspace schemes first so they win over project schemes
+            if (schemePaths[schemeName] != nil) {
+                continue;
+            }
+
+            schemePaths[schemeName] = @[[schemesPath stringByAppendingPathComponent:name],
+                                        container.stringByDeletingLastPathComponent];
+        }
+    }
+
+    return schemePaths;
+}
+
+- (NSArray *)schemeNames {
+    return [[self schemePaths].allKeys sortedArrayUsingSelector:@selector(compare:)];
+}
+
+- (NSArray *)buildableReferencesForSchemeNamed:(NSString *)schemeName
+                                         error:(NSError **)error {
+    error = error ?: &(NSError * __autoreleasing){nil};
+
+    NSArray *schemePath = [self schemePaths][schemeName];
+    if (schemePath == nil) {
+        *error = makeWorkspaceError(@"No shared scheme named \"%@\"", schemeName);
+        return nil;
+    }
+
+    NSData *contents = [NSData dataWithContentsOfFile:schemePath[0]];
+    NSXMLDocument *dom = (contents != nil ?
+                          [[NSXMLDocument alloc] initWithData:contents
+                                                      options:0
+                                                        error:error] :
+                          nil);
+    if (dom == nil) {
+        *error = *error ?: makeWorkspaceError(@"Could not read scheme %@", schemePath[0]);
+        return nil;
+    }
+
+    NSMutableArray *buildableReferences = [NSMutableArray array];
+    NSMutableSet *seen = [NSMutableSet set];
+    for (NSXMLElement *element in [dom nodesForXPath:
+                                   @"/Scheme/BuildAction/BuildActionEntries/"
+                                   @"BuildActionEntry/BuildableReference"
+                                                error:NULL]) {
+        NSString *targetName = [element attributeForName:@"BlueprintName"].stringValue;
+        NSString *container = [element attributeForName:@"ReferencedContainer"].stringValue;
+        NSString *projectPath = resolveLocation(container, schemePath[1],
+                                                schemePath[1], nil);
+        if (targetName == nil ||
+            ![projectPath.pathExtension isEqualToString:@"xcodeproj"]) {
+            continue;
+        }
+
+        NSString *key = [projectPath stringByAppendingPathComponent:targetName];
+        if ([seen containsObject:key]) {
+            continue;
+        }
+        [seen addObject:key];
+
+        [buildableReferences addObject:[[XCSchemeBuildableReference alloc]
+                                        initWithProjectPath:projectPath
+                                        targetName:targetName]];
+    }
+
+    return buildableReferences;
+}
+
+@end
@@ -23,12 +23,16 @@
 #import "DefaultConfig.h"
 #import "PerformParameters.h"
 
+@class AbstractMatch;
+
 @interface AbstractAction : NSObject
 @property(nonatomic, weak, readonly) ResourceLinter *linter;
 @property(nonatomic, copy, readonly) NSString *file;
 @property(nonatomic, assign, readonly) TextLocation textLocation;
 @property(nonatomic, copy, readonly) NSString *argumentString;
 @property(nonatomic, assign, readonly) BOOL isDefaultConfig;
+// set by -[AbstractMatch addAction:]
+@property(nonatomic, weak, readwrite) AbstractMatch *matcher;
 
 + (NSString *)name;
 + (id)defaultConfigValueFromArgument:(NSString *)argument
@@ -41,5 +45,11 @@
       argumentString:(NSString *)argumentString
      isDefaultConfig:(BOOL)isDefaultConfig NS_DESIGNATED_INITIALIZER;
 - (void)performWithParameters:(PerformParameters *)parameters;
+// called before matching, actions consuming resource content can schedule
+// reads using the linter contentPrefetcher
+- (void)prefetchResourceContent;
+// called when the matcher has matched all sources, actions deferring work
+// to let reads overlap with matching do it here
+- (void)finishMatch;
 - (NSArray *)configLines;
 @end
@@ -60,6 +60,12 @@
 - (void)performWithParameters:(PerformParameters *)parameters {
 }
 
+- (void)prefetchResourceContent {
+}
+
+- (void)finishMatch {
+}
+
 - (NSArray *)configLines {
     return [NSArray array];
 }
@@ -28,7 +28,8 @@
 @property(nonatomic, copy, readonly) NSString *argumentString;
 @property(nonatomic, assign, readonly) BOOL isDefaultConfig;
 @property(nonatomic, strong, readonly) NSMutableArray *actions;
-@property(nonatomic, strong, readonly) NSMutableArray *performParameters;
+// number of matches, only used to find matchers that match nothing
+@property(nonatomic, assign, readonly) NSUInteger matchCount;
 
 + (NSString *)name;
 
@@ -39,6 +40,10 @@
       argumentString:(NSString *)argumentString
      isDefaultConfig:(BOOL)isDefaultConfig NS_DESIGNATED_INITIALIZER;
 - (void)addAction:(AbstractAction *)action;
+// add matches counted by another linter, used when merging shards
+- (void)addMatchCount:(NSUInteger)matchCount;
+// count match and perform all actions
+- (void)performActionsWithParameters:(PerformParameters *)parameters;
 - (void)performMatch;
 - (NSArray *)configLines;
 @end
@@ -24,7 +24,7 @@
 @property(nonatomic, copy, readwrite) NSString *argumentString;
 @property(nonatomic, assign, readwrite) BOOL isDefaultConfig;
 @property(nonatomic, strong, readwrite) NSMutableArray *actions;
-@property(nonatomic, strong, readwrite) NSMutableArray *performParameters;
+@property(nonatomic, assign, readwrite) NSUInteger matchCount;
 @end
 
 @implementation AbstractMatch
@@ -49,15 +49,27 @@
     self.argumentString = argumentString;
     self.isDefaultConfig = isDefaultConfig;
     self.actions = [NSMutableArray array];
-    self.performParameters = [NSMutableArray array];
     
     return self;
 }
 
 - (void)addAction:(AbstractAction *)action {
+    action.matcher = self;
     [self.actions addObject:action];
 }
 
+- (void)addMatchCount:(NSUInteger)matchCount {
+    self.matchCount += matchCount;
+}
+
+- (void)performActionsWithParameters:(PerformParameters *)parameters {
+    self.matchCount++;
+
+    for (AbstractAction *action in self.actions) {
+        [action performWithParameters:parameters];
+    }
+}
+
 - (void)performMatch {
 }
 
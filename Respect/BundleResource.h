@@ -15,12 +15,24 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#import "PathTable.h"
+
 @interface BundleResource : NSObject
 @property(nonatomic, copy, readonly) NSString *buildSourcePath;
 @property(nonatomic, copy, readonly) NSString *path;
+// id of path in the linter PathTable
+@property(nonatomic, assign, readonly) NSUInteger pathID;
+// shared per path, used for report ordering
+@property(nonatomic, strong, readonly) NSData *pathSortKey;
 @property(nonatomic, strong, readonly) NSMutableArray *resourceReferences;
+// matchers with actions that referenced this resource
+@property(nonatomic, strong, readonly) NSMutableArray *matchers;
 
 - (instancetype)init NS_UNAVAILABLE;
 - (instancetype)initWithBuildSourcePath:(NSString *)buildSourcePath
-                                   path:(NSString *)path NS_DESIGNATED_INITIALIZER;
+                                   path:(NSString *)path
+                              pathTable:(PathTable *)pathTable NS_DESIGNATED_INITIALIZER;
+
+// message used by reports
+- (NSString *)unusedResourceMessage;
 @end
@@ -20,23 +20,34 @@
 @interface BundleResource ()
 @property(nonatomic, copy, readwrite) NSString *buildSourcePath;
 @property(nonatomic, copy, readwrite) NSString *path;
+@property(nonatomic, assign, readwrite) NSUInteger pathID;
+@property(nonatomic, strong, readwrite) NSData *pathSortKey;
 @property(nonatomic, strong, readwrite) NSMutableArray *resourceReferences;
+@property(nonatomic, strong, readwrite) NSMutableArray *matchers;
 @end
 
 @implementation BundleResource
 
 - (instancetype)initWithBuildSourcePath:(NSString *)buildSourcePath
-                                   path:(NSString *)path {
+                                   path:(NSString *)path
+                              pathTable:(PathTable *)pathTable {
     self = [super init];
     if (self == nil) {
         return nil;
     }
 
-    self.buildSourcePath = buildSourcePath;
-    self.path = path;
+    self.buildSourcePath = [pathTable internedPath:buildSourcePath];
+    self.pathID = [pathTable pathIDForPath:path];
+    self.path = [pathTable pathForPathID:self.pathID];
+    self.pathSortKey = [pathTable sortKeyForPathID:self.pathID];
     self.resourceReferences = [NSMutableArray array];
+    self.matchers = [NSMutableArray array];
 
     return self;
 }
 
+- (NSString *)unusedResourceMessage {
+    return [NSString stringWithFormat:@"Unused resource \"%@\"", self.path];
+}
+
 @end
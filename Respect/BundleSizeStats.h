@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Bytes of bundle resources aggregated per bundle directory and per matcher
+ * for referenced, unused and ignored unused resources. Used to prioritize
+ * cleanup by size instead of by count.
+ */
+
+#import "ResourceLinter.h"
+
+@interface BundleSizeStatsEntry : NSObject
+@property(nonatomic, copy, readonly) NSString *name;
+@property(nonatomic, assign, readonly) NSUInteger resourceCount;
+@property(nonatomic, assign, readonly) unsigned long long referencedBytes;
+@property(nonatomic, assign, readonly) unsigned long long unusedBytes;
+@property(nonatomic, assign, readonly) unsigned long long unusedIgnoredBytes;
+
+- (NSDictionary *)dictionaryRepresentation;
+@end
+
+@interface BundleSizeStats : NSObject
+@property(nonatomic, copy, readonly) NSString *projectName;
+@property(nonatomic, copy, readonly) NSString *targetName;
+@property(nonatomic, copy, readonly) NSString *configurationName;
+@property(nonatomic, strong, readonly) BundleSizeStatsEntry *total;
+// BundleSizeStatsEntry sorted by unused bytes, largest first
+@property(nonatomic, strong, readonly) NSArray *directories;
+// BundleSizeStatsEntry sorted by referenced bytes, largest first. a resource
+// referenced by more than one matcher is counted for each of them
+@property(nonatomic, strong, readonly) NSArray *matchers;
+
+// write array of BundleSizeStats as CSV if path ends with .csv else as JSON
++ (BOOL)writeStats:(NSArray *)stats toPath:(NSString *)path error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithLinter:(ResourceLinter *)linter NS_DESIGNATED_INITIALIZER;
+- (NSDictionary *)dictionaryRepresentation;
+@end
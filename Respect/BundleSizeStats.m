@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "BundleSizeStats.h"
+#import "BundleResource.h"
+#import "AbstractMatch.h"
+#import "NSString+Respect.h"
+#import "FileMetadataTable.h"
+
+@interface BundleSizeStatsEntry ()
+@property(nonatomic, copy, readwrite) NSString *name;
+@property(nonatomic, assign, readwrite) NSUInteger resourceCount;
+@property(nonatomic, assign, readwrite) unsigned long long referencedBytes;
+@property(nonatomic, assign, readwrite) unsigned long long unusedBytes;
+@property(nonatomic, assign, readwrite) unsigned long long unusedIgnoredBytes;
+@end
+
+@implementation BundleSizeStatsEntry
+
+- (NSDictionary *)dictionaryRepresentation {
+    return @{@"name": self.name,
+             @"resources": @(self.resourceCount),
+             @"referencedBytes": @(self.referencedBytes),
+             @"unusedBytes": @(self.unusedBytes),
+             @"unusedIgnoredBytes": @(self.unusedIgnoredBytes)};
+}
+
+@end
+
+@interface BundleSizeStats ()
+@property(nonatomic, copy, readwrite) NSString *projectName;
+@property(nonatomic, copy, readwrite) NSString *targetName;
+@property(nonatomic, copy, readwrite) NSString *configurationName;
+@property(nonatomic, strong, readwrite) BundleSizeStatsEntry *total;
+@property(nonatomic, strong, readwrite) NSArray *directories;
+@property(nonatomic, strong, readwrite) NSArray *matchers;
+@end
+
+@implementation BundleSizeStats
+
++ (NSString *)csvField:(NSString *)field {
+    if ([field rangeOfCharacterFromSet:
+         [NSCharacterSet characterSetWithCharactersInString:@",\"\r\n"]].location == NSNotFound) {
+        return field;
+    }
+
+    return [NSString stringWithFormat:@"\"%@\"",
+            [field stringByReplacingOccurrencesOfString:@"\"" withString:@"\"\""]];
+}
+
++ (BOOL)writeStats:(NSArray *)stats toPath:(NSString *)path error:(NSError **)error {
+    NSData *data = nil;
+
+    if ([path.pathExtension.lowercaseString isEqualToString:@"csv"]) {
+        NSMutableString *csv = [NSMutableString stringWithString:
+                                @"project,target,configuration,kind,name,resources,"
+                                @"referenced_bytes,unused_bytes,unused_ignored_bytes\n"];
+        for (BundleSizeStats *sizeStats in stats) {
+            NSArray *kindEntries = @[@[@"total", @[sizeStats.total]],
+                                     @[@"directory", sizeStats.directories],
+                                     @[@"matcher", sizeStats.matchers]];
+            for (NSArray *kindEntry in kindEntries) {
+                for (BundleSizeStatsEntry *entry in kindEntry[1]) {
+                    [csv appendFormat:@"%@,%@,%@,%@,%@,%lu,%llu,%llu,%llu\n",
+                     [self csvField:sizeStats.projectName ?: @""],
+                     [self csvField:sizeStats.targetName ?: @""],
+                     [self csvField:sizeStats.configurationName ?: @""],
+                     kindEntry[0],
+                     [self csvField:entry.name],
+                     entry.resourceCount,
+                     entry.referencedBytes,
+                     entry.unusedBytes,
+                     entry.unusedIgnoredBytes];
+                }
+            }
+        }
+        data = [csv dataUsingEncoding:NSUTF8StringEncoding];
+    } else {
+        data = [NSJSONSerialization dataWithJSONObject:[stats valueForKey:@"dictionaryRepresentation"]
+                                               options:NSJSONWritingPrettyPrinted
+                                                 error:error];
+        if (data == nil) {
+            return NO;
+        }
+    }
+
+    return [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
++ (BundleSizeStatsEntry *)entryNamed:(NSString *)name inDictionary:(NSMutableDictionary *)entries {
+    BundleSizeStatsEntry *entry = entries[name];
+    if (entry == nil) {
+        entry = [[BundleSizeStatsEntry alloc] init];
+        entry.name = name;
+        entries[name] = entry;
+    }
+
+    return entry;
+}
+
++ (NSString *)nameForMatcher:(AbstractMatch *)matcher sourceRoot:(NSString *)sourceRoot {
+    // actions not associated with any matcher
+    if (matcher.file == nil) {
+        return @"(static)";
+    }
+
+    return [NSString stringWithFormat:@"%@:%lu: @Lint%@: %@",
+            [matcher.file respect_stringRelativeToPathPrefix:sourceRoot],
+            matcher.textLocation.lineNumber,
+            [[matcher class] name],
+            matcher.argumentString];
+}
+
+- (instancetype)initWithLinter:(ResourceLinter *)linter {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    id<ResourceLinterSource> linterSource = linter.linterSource;
+    self.projectName = [linterSource projectName];
+    self.targetName = [linterSource targetName];
+    self.configurationName = [linterSource configurationName];
+
+    NSArray *resources = [linter.bundleResources allValues];
+    NSUInteger count = resources.count;
+    // stat all concurrently up front. directories, for example in folder
+    // references, count as zero as their content is added as separate
+    // resources
+    NSMutableArray *buildSourcePaths = [NSMutableArray arrayWithCapacity:count];
+    for (BundleResource *bundleRes in resources) {
+        if (bundleRes.buildSourcePath != nil) {
+            [buildSourcePaths addObject:bundleRes.buildSourcePath];
+        }
+    }
+    FileMetadataTable *fileMetadataTable = [[FileMetadataTable alloc] init];
+    [fileMetadataTable prefetchPaths:buildSourcePaths];
+
+    NSSet *unused = [NSSet setWithArray:linter.unusedResources];
+    NSSet *unusedIgnored = [NSSet setWithArray:linter.unusedResourcesIgnored];
+    NSString *sourceRoot = [linterSource sourceRoot];
+    BundleSizeStatsEntry *total = [[BundleSizeStatsEntry alloc] init];
+    total.name = @"";
+    NSMutableDictionary *directories = [NSMutableDictionary dictionary];
+    NSMutableDictionary *matchers = [NSMutableDictionary dictionary];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        BundleResource *bundleRes = resources[i];
+        unsigned long long size = [fileMetadataTable fileSizeAtPath:bundleRes.buildSourcePath];
+        NSString *directory = bundleRes.path.stringByDeletingLastPathComponent;
+        BundleSizeStatsEntry *dirEntry = [[self class]
+                                          entryNamed:directory.length > 0 ? directory : @"."
+                                          inDictionary:directories];
+
+        for (BundleSizeStatsEntry *entry in @[total, dirEntry]) {
+            entry.resourceCount++;
+            if ([unused containsObject:bundleRes]) {
+                entry.unusedBytes += size;
+            } else if ([unusedIgnored containsObject:bundleRes]) {
+                entry.unusedIgnoredBytes += size;
+            } else {
+                entry.referencedBytes += size;
+            }
+        }
+
+        for (AbstractMatch *matcher in bundleRes.matchers) {
+            BundleSizeStatsEntry *matcherEntry = [[self class]
+                                                  entryNamed:[[self class]
+                                                              nameForMatcher:matcher
+                                                              sourceRoot:sourceRoot]
+                                                  inDictionary:matchers];
+            matcherEntry.resourceCount++;
+            matcherEntry.referencedBytes += size;
+        }
+    }
+
+    self.total = total;
+    self.directories = [[directories allValues] sortedArrayUsingComparator:
+                        ^NSComparisonResult(BundleSizeStatsEntry *a, BundleSizeStatsEntry *b) {
+                            if (a.unusedBytes != b.unusedBytes) {
+                                return a.unusedBytes > b.unusedBytes ? NSOrderedAscending : NSOrderedDescending;
+                            }
+                            return [a.name compare:b.name];
+                        }];
+    self.matchers = [[matchers allValues] sortedArrayUsingComparator:
+                     ^NSComparisonResult(BundleSizeStatsEntry *a, BundleSizeStatsEntry *b) {
+                         if (a.referencedBytes != b.referencedBytes) {
+                             return a.referencedBytes > b.referencedBytes ? NSOrderedAscending : NSOrderedDescending;
+                         }
+                         return [a.name compare:b.name];
+                     }];
+
+    return self;
+}
+
+- (NSDictionary *)dictionaryRepresentation {
+    return @{@"project": self.projectName ?: @"",
+             @"target": self.targetName ?: @"",
+             @"configuration": self.configurationName ?: @"",
+             @"total": [self.total dictionaryRepresentation],
+             @"directories": [self.directories valueForKey:@"dictionaryRepresentation"],
+             @"matchers": [self.matchers valueForKey:@"dictionaryRepresentation"]};
+}
+
+@end
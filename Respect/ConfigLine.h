@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/*
+ * A "@Lint<Name>[Default]: argument" config line. Found in source and config
+ * files or loaded from a table generated from IOSDefault.config at build
+ * time so that the default config needs no scanning at runtime.
+ */
+
+#import "TextFile.h"
+#import "TextLocation.h"
+
+// entry in table generated by misc/config_table.rb
+typedef struct _ConfigLineEntry {
+    NSUInteger lineNumber;
+    NSUInteger column;
+    NSUInteger length;
+    const char *name;
+    BOOL isDefault;
+    const char *argument;
+} ConfigLineEntry;
+
+@interface ConfigLine : NSObject
+@property(nonatomic, copy, readonly) NSString *file;
+@property(nonatomic, assign, readonly) TextLocation textLocation;
+@property(nonatomic, copy, readonly) NSString *name;
+@property(nonatomic, assign, readonly) BOOL isDefault;
+// ":" or " " if colon is missing
+@property(nonatomic, copy, readonly) NSString *separator;
+@property(nonatomic, copy, readonly) NSString *argument;
+
++ (NSArray *)configLinesInTextFile:(TextFile *)textFile;
+// $(NAME) in arguments are replaced using variables
++ (NSArray *)configLinesFromEntries:(const ConfigLineEntry *)entries
+                              count:(NSUInteger)count
+                               file:(NSString *)file
+                          variables:(NSDictionary *)variables;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithFile:(NSString *)file
+                textLocation:(TextLocation)textLocation
+                        name:(NSString *)name
+                   isDefault:(BOOL)isDefault
+                   separator:(NSString *)separator
+                    argument:(NSString *)argument NS_DESIGNATED_INITIALIZER;
+@end
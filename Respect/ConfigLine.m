@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ConfigLine.h"
+#import "NSString+Respect.h"
+#import "NSString+PBXProject.h"
+
+@interface ConfigLine ()
+@property(nonatomic, copy, readwrite) NSString *file;
+@property(nonatomic, assign, readwrite) TextLocation textLocation;
+@property(nonatomic, copy, readwrite) NSString *name;
+@property(nonatomic, assign, readwrite) BOOL isDefault;
+@property(nonatomic, copy, readwrite) NSString *separator;
+@property(nonatomic, copy, readwrite) NSString *argument;
+@end
+
+@implementation ConfigLine
+
+// index of line range containing location, lineRanges are sorted so bisect
+static NSUInteger lineIndexForLocation(NSArray *lineRanges, NSUInteger location) {
+    NSUInteger low = 0;
+    NSUInteger high = lineRanges.count;
+
+    while (low + 1 < high) {
+        NSUInteger mid = low + (high - low) / 2;
+        if ([lineRanges[mid] rangeValue].location <= location) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
++ (NSArray *)configLinesInTextFile:(TextFile *)textFile {
+    static NSRegularExpression *re = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        re = [NSRegularExpression
+              // capture group 1 is name
+              // capture group 2 is "Default" optionally
+              // capture group 3 is separator
+              // capture group 4 is argument
+              // keep in sync with misc/config_table.rb
+              regularExpressionWithPattern:@"@Lint([A-Za-z]+?)(Default)?(:| )(.*+)"
+              options:0
+              error:NULL];
+    });
+
+    NSString *text = textFile.text;
+    NSArray *lineRanges = textFile.lineRanges;
+    NSMutableArray *configLines = [NSMutableArray array];
+    NSRange searchRange = NSMakeRange(0, text.length);
+
+    // most files have no config at all so do a cheap literal search for
+    // "@Lint" and only run the regex anchored at each hit inside its line
+    for (;;) {
+        NSRange lintRange = [text rangeOfString:@"@Lint"
+                                        options:NSLiteralSearch
+                                          range:searchRange];
+        if (lintRange.location == NSNotFound) {
+            break;
+        }
+
+        NSUInteger lineIndex = lineIndexForLocation(lineRanges, lintRange.location);
+        NSRange lineRange = [lineRanges[lineIndex] rangeValue];
+        NSTextCheckingResult *result = [re
+                                        firstMatchInString:text
+                                        options:NSMatchingAnchored
+                                        range:NSMakeRange(lintRange.location,
+                                                          NSMaxRange(lineRange) -
+                                                          lintRange.location)];
+        if (result == nil) {
+            searchRange.location = NSMaxRange(lintRange);
+            searchRange.length = text.length - searchRange.location;
+            continue;
+        }
+
+        [configLines addObject:
+         [[ConfigLine alloc]
+          initWithFile:textFile.path
+          // line number and range inside line starting from 1
+          textLocation:MakeTextLocation(lineIndex + 1,
+                                        NSMakeRange(result.range.location -
+                                                    lineRange.location + 1,
+                                                    result.range.length))
+          name:[text substringWithRange:[result rangeAtIndex:1]]
+          isDefault:[result rangeAtIndex:2].location != NSNotFound
+          separator:[text substringWithRange:[result rangeAtIndex:3]]
+          argument:[[text substringWithRange:[result rangeAtIndex:4]]
+                    respect_stringByTrimmingWhitespace]]];
+
+        // argument consumes rest of line
+        searchRange.location = NSMaxRange(result.range);
+        searchRange.length = text.length - searchRange.location;
+    }
+
+    return configLines;
+}
+
++ (NSArray *)configLinesFromEntries:(const ConfigLineEntry *)entries
+                              count:(NSUInteger)count
+                               file:(NSString *)file
+                          variables:(NSDictionary *)variables {
+    NSMutableArray *configLines = [NSMutableArray arrayWithCapacity:count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        const ConfigLineEntry *entry = &entries[i];
+        NSString *argument = @(entry->argument);
+        if ([argument rangeOfString:@"$("].location != NSNotFound) {
+            argument = [argument pbx_stringByReplacingVariablesFromDict:variables];
+        }
+
+        [configLines addObject:
+         [[ConfigLine alloc]
+          initWithFile:file
+          textLocation:MakeTextLocation(entry->lineNumber,
+                                        NSMakeRange(entry->column, entry->length))
+          name:@(entry->name)
+          isDefault:entry->isDefault
+          separator:@":"
+          argument:argument]];
+    }
+
+    return configLines;
+}
+
+- (instancetype)initWithFile:(NSString *)file
+                textLocation:(TextLocation)textLocation
+                        name:(NSString *)name
+                   isDefault:(BOOL)isDefault
+                   separator:(NSString *)separator
+                    argument:(NSString *)argument {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.file = file;
+    self.textLocation = textLocation;
+    self.name = name;
+    self.isDefault = isDefault;
+    self.separator = separator;
+    self.argument = argument;
+
+    return self;
+}
+
+@end
@@ -0,0 +1,28 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Finds bundle resources with identical file content. Files are first
+ * grouped by size and only files with colliding sizes are hashed, so for
+ * most bundles only a few files are read at all. Hash matches are confirmed
+ * with a full compare.
+ */
+
+@interface DuplicateContentFinder : NSObject
+// array of BundleResource in, array of arrays of BundleResource with same
+// content out. groups and resources in groups are sorted by bundle path.
++ (NSArray *)duplicateGroupsInBundleResources:(NSArray *)bundleResources;
+@end
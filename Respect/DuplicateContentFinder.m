@@ -0,0 +1,187 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "DuplicateContentFinder.h"
+#import "BundleResource.h"
+#import "NSString+Respect.h"
+
+#include <sys/stat.h>
+
+static NSComparator bundleResourcePathComparator = ^NSComparisonResult(id a, id b) {
+    BundleResource *aRes = a;
+    BundleResource *bRes = b;
+    return RespectCompareUsingSortKeys(aRes.path, aRes.pathSortKey,
+                                       bRes.path, bRes.pathSortKey);
+};
+
+// word at a time FNV-1a variant, not cryptographic but only used to find
+// candidates that are then compared byte by byte
+static uint64_t content_hash(const uint8_t *bytes, size_t length) {
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL ^ length;
+    size_t i = 0;
+
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+        hash ^= hash >> 29;
+    }
+    for (; i < length; i++) {
+        hash = (hash ^ bytes[i]) * prime;
+    }
+
+    return hash;
+}
+
+@implementation DuplicateContentFinder
+
++ (NSData *)mappedContentOfFile:(NSString *)path {
+    return [NSData dataWithContentsOfFile:path
+                                  options:NSDataReadingMappedIfSafe
+                                    error:NULL];
+}
+
++ (NSArray *)duplicateGroupsInBundleResources:(NSArray *)bundleResources {
+    // same source file can be copied to more than one bundle path
+    NSMutableDictionary *sourcePathResources = [NSMutableDictionary dictionary];
+    for (BundleResource *bundleRes in bundleResources) {
+        NSMutableArray *resources = sourcePathResources[bundleRes.buildSourcePath];
+        if (resources == nil) {
+            resources = [NSMutableArray array];
+            sourcePathResources[bundleRes.buildSourcePath] = resources;
+        }
+        [resources addObject:bundleRes];
+    }
+
+    // group source paths by size, skip directories and empty files
+    NSMutableDictionary *sizeSourcePaths = [NSMutableDictionary dictionary];
+    NSMutableDictionary *sourcePathSizes = [NSMutableDictionary dictionary];
+    for (NSString *sourcePath in sourcePathResources) {
+        struct stat st;
+        if (stat(sourcePath.fileSystemRepresentation, &st) != 0 ||
+            !S_ISREG(st.st_mode) ||
+            st.st_size == 0) {
+            continue;
+        }
+
+        NSNumber *size = @(st.st_size);
+        sourcePathSizes[sourcePath] = size;
+        NSMutableArray *sourcePaths = sizeSourcePaths[size];
+        if (sourcePaths == nil) {
+            sourcePaths = [NSMutableArray array];
+            sizeSourcePaths[size] = sourcePaths;
+        }
+        [sourcePaths addObject:sourcePath];
+    }
+
+    NSMutableArray *candidatePaths = [NSMutableArray array];
+    NSMutableArray *candidateSizes = [NSMutableArray array];
+    for (NSNumber *size in sizeSourcePaths) {
+        NSArray *sourcePaths = sizeSourcePaths[size];
+        if (sourcePaths.count < 2) {
+            continue;
+        }
+        for (NSString *sourcePath in sourcePaths) {
+            [candidatePaths addObject:sourcePath];
+            [candidateSizes addObject:size];
+        }
+    }
+
+    NSUInteger candidateCount = candidatePaths.count;
+    uint64_t *hashes = calloc(MAX(candidateCount, 1), sizeof(uint64_t));
+    BOOL *hashed = calloc(MAX(candidateCount, 1), sizeof(BOOL));
+    dispatch_apply(candidateCount,
+                   dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                   ^(size_t i) {
+                       @autoreleasepool {
+                           NSData *data = [self mappedContentOfFile:candidatePaths[i]];
+                           if (data == nil) {
+                               return;
+                           }
+                           hashes[i] = content_hash(data.bytes, data.length);
+                           hashed[i] = YES;
+                       }
+                   });
+
+    NSMutableDictionary *hashSourcePaths = [NSMutableDictionary dictionary];
+    for (NSUInteger i = 0; i < candidateCount; i++) {
+        if (!hashed[i]) {
+            continue;
+        }
+
+        NSArray *key = @[candidateSizes[i], @(hashes[i])];
+        NSMutableArray *sourcePaths = hashSourcePaths[key];
+        if (sourcePaths == nil) {
+            sourcePaths = [NSMutableArray array];
+            hashSourcePaths[key] = sourcePaths;
+        }
+        [sourcePaths addObject:candidatePaths[i]];
+    }
+    free(hashes);
+    free(hashed);
+
+    NSMutableArray *groups = [NSMutableArray array];
+
+    // same source copied to multiple bundle paths without any other file
+    // of the same size is not hashed but is still duplicate content
+    for (NSString *sourcePath in sourcePathResources) {
+        NSArray *resources = sourcePathResources[sourcePath];
+        NSNumber *size = sourcePathSizes[sourcePath];
+        if (resources.count > 1 &&
+            size != nil &&
+            [sizeSourcePaths[size] count] < 2) {
+            [groups addObject:[resources mutableCopy]];
+        }
+    }
+
+    for (NSArray *sourcePaths in [hashSourcePaths objectEnumerator]) {
+        // partition by actual content in case of hash collisions
+        NSMutableArray *remaining = [sourcePaths mutableCopy];
+        while (remaining.count > 0) {
+            NSString *firstPath = remaining[0];
+            NSData *firstData = [self mappedContentOfFile:firstPath];
+            NSMutableArray *group = [sourcePathResources[firstPath] mutableCopy];
+            NSMutableIndexSet *grouped = [NSMutableIndexSet indexSetWithIndex:0];
+
+            for (NSUInteger i = 1; i < remaining.count; i++) {
+                NSData *data = [self mappedContentOfFile:remaining[i]];
+                if (firstData != nil &&
+                    data.length == firstData.length &&
+                    memcmp(data.bytes, firstData.bytes, data.length) == 0) {
+                    [group addObjectsFromArray:sourcePathResources[remaining[i]]];
+                    [grouped addIndex:i];
+                }
+            }
+            [remaining removeObjectsAtIndexes:grouped];
+
+            if (group.count > 1) {
+                [groups addObject:group];
+            }
+        }
+    }
+
+    for (NSMutableArray *group in groups) {
+        [group sortUsingComparator:bundleResourcePathComparator];
+    }
+    [groups sortUsingComparator:^NSComparisonResult(id a, id b) {
+        return bundleResourcePathComparator([a firstObject], [b firstObject]);
+    }];
+
+    return groups;
+}
+
+@end
@@ -15,10 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
-// Parses "expression signature" strings to regex for matching
+// Parses "expression signature" strings and matches them against source
+// tokens. Translation to regex is only used to show the signature in dumped
+// config, matching is done structurally on tokens as nested sends and skip
+// arguments could make the regex backtrack a lot on long lines.
 
 #import <Foundation/Foundation.h>
 #import "PeekableEnumerator.h"
+#import "SourceTokens.h"
 
 extern NSString * const SignatureMatcherErrorDomain;
 
@@ -26,6 +30,12 @@ extern NSString * const SignatureMatcherErrorDomain;
 + (id<ExpressionSignature>)parseTokens:(PeekableEnumerator *)tokens
                                  error:(NSError **)error;
 - (NSString *)toPattern;
+// match starting at token index, returns index of token after match or
+// NSNotFound. ranges are added to captures as NSValue in same order as the
+// capture groups of toPattern
+- (NSUInteger)matchSourceTokens:(SourceTokens *)tokens
+                        atIndex:(NSUInteger)index
+                       captures:(NSMutableArray *)captures;
 @end
 
 @interface ExpressionSignature : NSObject<ExpressionSignature>
@@ -35,4 +45,10 @@ extern NSString * const SignatureMatcherErrorDomain;
                                        error:(NSError **)error;
 + (NSRegularExpression *)stringToRegEx:(NSString *)signature
                                  error:(NSError **)error;
+// non-overlapping matches, range is whole match and captureRanges NSValue ranges
++ (void)enumerateMatchesOfSignature:(id<ExpressionSignature>)signature
+                     inSourceTokens:(SourceTokens *)tokens
+                         usingBlock:(void (^)(NSRange range,
+                                              NSArray *captureRanges,
+                                              BOOL *stop))block;
 @end
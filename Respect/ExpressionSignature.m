@@ -118,10 +118,46 @@ NSString * const ExpressionSignatureErrorDomain = @"ExpressionSignatureErrorDoma
     }
 }
 
++ (void)enumerateMatchesOfSignature:(id<ExpressionSignature>)signature
+                     inSourceTokens:(SourceTokens *)tokens
+                         usingBlock:(void (^)(NSRange range,
+                                              NSArray *captureRanges,
+                                              BOOL *stop))block {
+    NSMutableArray *captures = [NSMutableArray array];
+    NSUInteger count = tokens.count;
+    NSUInteger index = 0;
+    BOOL stop = NO;
+
+    while (index < count && !stop) {
+        NSUInteger end = [signature matchSourceTokens:tokens
+                                              atIndex:index
+                                             captures:captures];
+        if (end == NSNotFound || end == index) {
+            index++;
+            continue;
+        }
+
+        NSUInteger location = [tokens tokenAtIndex:index]->range.location;
+        NSRange range = NSMakeRange(location,
+                                    NSMaxRange([tokens tokenAtIndex:end-1]->range) - location);
+        block(range, [captures copy], &stop);
+        [captures removeAllObjects];
+
+        // continue after match as regex enumeration would do
+        index = end;
+    }
+}
+
 - (NSString *)toPattern {
     return @"";
 }
 
+- (NSUInteger)matchSourceTokens:(SourceTokens *)tokens
+                        atIndex:(NSUInteger)index
+                       captures:(NSMutableArray *)captures {
+    return NSNotFound;
+}
+
 - (NSString *)description {
     return @"";
 }
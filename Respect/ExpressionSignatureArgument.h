@@ -26,6 +26,16 @@ typedef NS_ENUM(NSInteger, ExpressionSignatureArgumentType) {
 @interface ExpressionSignatureArgument : NSObject<ExpressionSignature>
 @property(nonatomic, assign, readwrite) ExpressionSignatureArgumentType type;
 
++ (BOOL)isSkipArgument:(id<ExpressionSignature>)argument;
+// skip arguments match one or more tokens, balanced groups counted as one
+// token, until comma or a parameter name followed by colon. returns index
+// of token stopped at or NSNotFound
++ (NSUInteger)skipSourceTokens:(SourceTokens *)tokens
+                     fromIndex:(NSUInteger)index
+                      endIndex:(NSUInteger)endIndex
+                   stopAtComma:(BOOL)stopAtComma
+               stopAtParameter:(NSString *)parameterName;
+
 - (instancetype)init NS_UNAVAILABLE;
 - (instancetype)initWithType:(ExpressionSignatureArgumentType)type NS_DESIGNATED_INITIALIZER;
 @end
@@ -34,6 +34,55 @@
     return nil;
 }
 
++ (BOOL)isSkipArgument:(id<ExpressionSignature>)argument {
+    return ([argument isKindOfClass:[ExpressionSignatureArgument class]] &&
+            ((ExpressionSignatureArgument *)argument).type == SIGNATURE_ARGUMENT_SKIP);
+}
+
++ (NSUInteger)skipSourceTokens:(SourceTokens *)tokens
+                     fromIndex:(NSUInteger)index
+                      endIndex:(NSUInteger)endIndex
+                   stopAtComma:(BOOL)stopAtComma
+               stopAtParameter:(NSString *)parameterName {
+    NSUInteger i = index;
+    while (i < endIndex) {
+        const SourceToken *token = [tokens tokenAtIndex:i];
+
+        if (i > index) {
+            if (stopAtComma && token->type == SOURCE_TOKEN_COMMA) {
+                return i;
+            }
+
+            if (parameterName != nil &&
+                [tokens tokenAtIndex:i matchesIdent:parameterName] &&
+                [tokens tokenAtIndex:i+1 isType:SOURCE_TOKEN_COLON]) {
+                return i;
+            }
+        }
+
+        if (token->type == SOURCE_TOKEN_SEMICOLON) {
+            // statement ended, source is not what we think it is
+            return NSNotFound;
+        } else if (token->type == SOURCE_TOKEN_OPEN_BRACKET ||
+                   token->type == SOURCE_TOKEN_OPEN_PARENTHESES ||
+                   token->type == SOURCE_TOKEN_OPEN_BRACE) {
+            if (token->pair == NSNotFound) {
+                return NSNotFound;
+            }
+            i = token->pair + 1;
+        } else {
+            i++;
+        }
+    }
+
+    // reaching end is only ok if not looking for something and skipped something
+    if (stopAtComma || parameterName != nil || i == index) {
+        return NSNotFound;
+    }
+
+    return i;
+}
+
 - (instancetype)initWithType:(ExpressionSignatureArgumentType)type {
     self = [super init];
     if (self == nil) {
@@ -63,6 +112,30 @@
     return nil;
 }
 
+- (NSUInteger)matchSourceTokens:(SourceTokens *)tokens
+                        atIndex:(NSUInteger)index
+                       captures:(NSMutableArray *)captures {
+    if (self.type == SIGNATURE_ARGUMENT_STRING) {
+        if (![tokens tokenAtIndex:index isType:SOURCE_TOKEN_STRING]) {
+            return NSNotFound;
+        }
+
+        [captures addObject:[NSValue valueWithRange:
+                             [tokens stringContentRangeOfTokenAtIndex:index]]];
+        return index + 1;
+    } else if (self.type == SIGNATURE_ARGUMENT_NAME) {
+        if (![tokens tokenAtIndex:index isType:SOURCE_TOKEN_IDENT]) {
+            return NSNotFound;
+        }
+
+        [captures addObject:[NSValue valueWithRange:[tokens tokenAtIndex:index]->range]];
+        return index + 1;
+    }
+
+    // skip depends on what follows so it is matched by the call or send
+    return NSNotFound;
+}
+
 - (NSString *)description {
     if (self.type == SIGNATURE_ARGUMENT_STRING) {
         return @"@";
@@ -120,4 +120,58 @@
     return pattern;
 }
 
+- (NSUInteger)matchSourceTokens:(SourceTokens *)tokens
+                        atIndex:(NSUInteger)index
+                       captures:(NSMutableArray *)captures {
+    NSUInteger open = [self.name matchSourceTokens:tokens atIndex:index captures:captures];
+    if (open == NSNotFound ||
+        ![tokens tokenAtIndex:open isType:SOURCE_TOKEN_OPEN_PARENTHESES]) {
+        return NSNotFound;
+    }
+
+    NSUInteger close = [tokens tokenAtIndex:open]->pair;
+    if (close == NSNotFound) {
+        return NSNotFound;
+    }
+
+    NSUInteger capturesCount = captures.count;
+    NSUInteger i = open + 1;
+    NSUInteger argumentIndex = 0;
+    for (id<ExpressionSignature> argument in self.arguments) {
+        BOOL isLast = argumentIndex == self.arguments.count-1;
+
+        if ([ExpressionSignatureArgument isSkipArgument:argument]) {
+            // last skip argument also skips commas, p(@,) matches p(@"a", b, c)
+            i = [ExpressionSignatureArgument skipSourceTokens:tokens
+                                                    fromIndex:i
+                                                     endIndex:close
+                                                  stopAtComma:!isLast
+                                              stopAtParameter:nil];
+        } else {
+            i = [argument matchSourceTokens:tokens atIndex:i captures:captures];
+        }
+
+        if (i == NSNotFound) {
+            break;
+        }
+
+        if (!isLast) {
+            if (![tokens tokenAtIndex:i isType:SOURCE_TOKEN_COMMA]) {
+                i = NSNotFound;
+                break;
+            }
+            i++;
+        }
+
+        argumentIndex++;
+    }
+
+    if (i != close) {
+        [captures removeObjectsInRange:NSMakeRange(capturesCount, captures.count - capturesCount)];
+        return NSNotFound;
+    }
+
+    return close + 1;
+}
+
 @end
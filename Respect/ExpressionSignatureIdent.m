@@ -49,6 +49,16 @@
                                                 withString:@"[\\w\\d_$]*"];
 }
 
+- (NSUInteger)matchSourceTokens:(SourceTokens *)tokens
+                        atIndex:(NSUInteger)index
+                       captures:(NSMutableArray *)captures {
+    if (![tokens tokenAtIndex:index matchesIdent:self.name]) {
+        return NSNotFound;
+    }
+
+    return index + 1;
+}
+
 - (NSString *)description {
     return self.name;
 }
@@ -173,5 +173,67 @@
     return pattern;
 }
 
+- (NSUInteger)matchSourceTokens:(SourceTokens *)tokens
+                        atIndex:(NSUInteger)index
+                       captures:(NSMutableArray *)captures {
+    if (![tokens tokenAtIndex:index isType:SOURCE_TOKEN_OPEN_BRACKET]) {
+        return NSNotFound;
+    }
+
+    NSUInteger close = [tokens tokenAtIndex:index]->pair;
+    if (close == NSNotFound) {
+        return NSNotFound;
+    }
+
+    NSUInteger capturesCount = captures.count;
+    NSUInteger i = [self.receiver matchSourceTokens:tokens atIndex:index+1 captures:captures];
+    NSUInteger parameterIndex = 0;
+    for (ExpressionSignatureSendParameter *parameter in self.parameters) {
+        if (i == NSNotFound) {
+            break;
+        }
+
+        if (![tokens tokenAtIndex:i matchesIdent:parameter.name]) {
+            i = NSNotFound;
+            break;
+        }
+        i++;
+        parameterIndex++;
+
+        if (parameter.argument == nil) {
+            continue;
+        }
+
+        if (![tokens tokenAtIndex:i isType:SOURCE_TOKEN_COLON]) {
+            i = NSNotFound;
+            break;
+        }
+        i++;
+
+        if ([ExpressionSignatureArgument isSkipArgument:parameter.argument]) {
+            NSString *nextName = nil;
+            if (parameterIndex < self.parameters.count) {
+                nextName = ((ExpressionSignatureSendParameter *)
+                            self.parameters[parameterIndex]).name;
+            }
+
+            i = [ExpressionSignatureArgument skipSourceTokens:tokens
+                                                    fromIndex:i
+                                                     endIndex:close
+                                                  stopAtComma:NO
+                                              stopAtParameter:nextName];
+        } else {
+            i = [parameter.argument matchSourceTokens:tokens atIndex:i captures:captures];
+        }
+    }
+
+    if (i != close) {
+        [captures removeObjectsInRange:NSMakeRange(capturesCount, captures.count - capturesCount)];
+        return NSNotFound;
+    }
+
+    return close + 1;
+}
+
 
 @end
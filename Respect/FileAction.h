@@ -37,5 +37,14 @@ typedef NS_ENUM(NSInteger, FileReferenceCondition) {
 - (NSArray *)actionResourcePaths:(NSString *)resourcePath;
 - (NSString *)actionMissingResourceHint:(NSString *)resourcePath;
 - (void)actionForMatchedBundleResource:(BundleResource *)bundleRes;
+// resource paths for permutations without parameters, known before matching
+- (NSArray *)staticResourcePaths;
+// adds reference to linter if not already added, returns matched bundle
+// resource only the first time this action adds the reference so that each
+// action acts once per reference even if other actions added it before
+- (BundleResource *)addReferenceToResourcePath:(NSString *)resourcePath
+                                 referencePath:(NSString *)referencePath
+                             referenceLocation:(TextLocation)referenceLocation
+                                 referenceHint:(NSString *)referenceHint;
 
 @end
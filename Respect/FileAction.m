@@ -20,11 +20,15 @@
 #import "BundleResource.h"
 #import "ConfigError.h"
 #import "NSString+Respect.h"
+#import "ParameterTemplate.h"
 
 
 @interface FileAction ()
 @property(nonatomic, assign, readwrite) BOOL hasError;
+// array of ParameterTemplate, one per permutation
 @property(nonatomic, strong, readwrite) NSArray *resourcePathTemplates;
+// ResourceReference already added by this action, graph dedupes across actions
+@property(nonatomic, strong, readwrite) NSHashTable *addedReferences;
 @end
 
 @implementation FileAction
@@ -52,9 +56,16 @@
     
     self.condition = condition;
     self.permutationsPattern = permutationsPattern;
-    self.resourcePathTemplates = [permutationsPattern
-                                  respect_permutationsUsingGroupCharacterPair:@"{}"
-                                  withSeparators:@","];
+    self.addedReferences = [NSHashTable hashTableWithOptions:
+                            NSPointerFunctionsStrongMemory |
+                            NSPointerFunctionsObjectPointerPersonality];
+    NSMutableArray *resourcePathTemplates = [NSMutableArray array];
+    for (NSString *permutation in [permutationsPattern
+                                   respect_permutationsUsingGroupCharacterPair:@"{}"
+                                   withSeparators:@","]) {
+        [resourcePathTemplates addObject:[ParameterTemplate templateWithString:permutation]];
+    }
+    self.resourcePathTemplates = resourcePathTemplates;
     
     [self actionOptions:options];
     
@@ -163,7 +174,8 @@
 - (NSString *)actionMissingResourceHint:(NSString *)resourcePath {
     BundleResource *bundlRef =  self.linter.lowercaseBundleResources[resourcePath.lowercaseString];
     if (bundlRef == nil) {
-        return nil;
+        // typos like btn_close vs btn-close
+        return [self.linter suggestedBundleResourcePathForPath:resourcePath];
     }
     
     return bundlRef.path;
@@ -172,50 +184,86 @@
 - (void)actionForMatchedBundleResource:(BundleResource *)bundleRes {
 }
 
+- (NSArray *)staticResourcePaths {
+    NSMutableArray *paths = [NSMutableArray array];
+    for (ParameterTemplate *resourcePathTemplate in self.resourcePathTemplates) {
+        if (resourcePathTemplate.hasParameters) {
+            continue;
+        }
+
+        [paths addObjectsFromArray:
+         [self actionResourcePaths:[resourcePathTemplate stringByReplacingParameters:@[]]]];
+    }
+
+    return paths;
+}
+
+- (BundleResource *)addReferenceToResourcePath:(NSString *)resourcePath
+                                 referencePath:(NSString *)referencePath
+                             referenceLocation:(TextLocation)referenceLocation
+                                 referenceHint:(NSString *)referenceHint {
+    BundleResource *bundleRes = self.linter.bundleResources[resourcePath];
+    BOOL isNew = NO;
+    ResourceReference *resourceRef = [self.linter.referenceGraph
+                                      addReferenceToResourcePath:resourcePath
+                                      referencePath:referencePath
+                                      referenceLocation:referenceLocation
+                                      referenceHint:referenceHint
+                                      missingResourceHint:^NSString *{
+                                          return (bundleRes == nil ?
+                                                  [self actionMissingResourceHint:resourcePath] :
+                                                  nil);
+                                      }
+                                      isNew:&isNew];
+    if (bundleRes != nil && self.matcher != nil &&
+        ![bundleRes.matchers containsObject:self.matcher]) {
+        [bundleRes.matchers addObject:self.matcher];
+    }
+    if (bundleRes == nil) {
+        return nil;
+    }
+    if (isNew) {
+        [bundleRes.resourceReferences addObject:resourceRef];
+        [resourceRef.bundleResources addObject:bundleRes];
+    }
+    if ([self.addedReferences containsObject:resourceRef]) {
+        return nil;
+    }
+    [self.addedReferences addObject:resourceRef];
+
+    return bundleRes;
+}
+
 - (void)performWithParameters:(PerformParameters *)parameters {
     if (self.hasError) {
         return;
     }
     
-    NSMutableArray *missingRefs = [NSMutableArray array];
+    NSMutableArray *missingResourcePaths = [NSMutableArray array];
     NSUInteger templatesMatchCount = 0;
     
-    for (NSString *pathTemplate in self.resourcePathTemplates) {
+    for (ParameterTemplate *pathTemplate in self.resourcePathTemplates) {
         NSUInteger resourcePathsMatchCount = 0;
         
         NSArray *resourcePaths = [self actionResourcePaths:
-                                  [pathTemplate respect_stringByReplacingParameters:parameters.parameters]];
+                                  [pathTemplate stringByReplacingParameters:parameters.parameters]];
         
         for (NSString *resourcePath in resourcePaths) {
-            BundleResource *bundleRes = self.linter.bundleResources[resourcePath];
-            ResourceReference *resourceRef = nil;
-            
-            if (bundleRes == nil) {
-                resourceRef = [[ResourceReference alloc]
-                                initWithResourcePath:resourcePath
-                                referencePath:parameters.path
-                                referenceLocation:parameters.textLocation
-                                missingResourceHint:[self actionMissingResourceHint:resourcePath]];
-                
-                [missingRefs addObject:resourceRef];
-                
+            if (self.linter.bundleResources[resourcePath] == nil) {
+                [missingResourcePaths addObject:resourcePath];
                 continue;
             }
             
             resourcePathsMatchCount++;
             
-            resourceRef = [[ResourceReference alloc]
-                            initWithResourcePath:resourcePath
-                            referencePath:parameters.path
-                            referenceLocation:parameters.textLocation
-                            missingResourceHint:nil];
-            
-            [bundleRes.resourceReferences addObject:resourceRef];
-            [resourceRef.bundleResources addObject:bundleRes];
-            
-            [self.linter.resourceReferences addObject:resourceRef];
-            
-            [self actionForMatchedBundleResource:bundleRes];
+            // only act once per reference from same location
+            BundleResource *bundleRes = [self addReferenceToResourcePath:resourcePath
+                                                           referencePath:parameters.path
+                                                       referenceLocation:parameters.textLocation
+                                                           referenceHint:nil];
+            if (bundleRes != nil) {
+                [self actionForMatchedBundleResource:bundleRes];
+            }
         }
         
         if (resourcePaths.count == resourcePathsMatchCount) {
@@ -235,7 +283,12 @@
     }
     
     // all, add any missing references
-    [self.linter.resourceReferences addObjectsFromArray:missingRefs];
+    for (NSString *resourcePath in missingResourcePaths) {
+        [self addReferenceToResourcePath:resourcePath
+                           referencePath:parameters.path
+                       referenceLocation:parameters.textLocation
+                           referenceHint:nil];
+    }
 }
 
 - (NSArray *)configLines {
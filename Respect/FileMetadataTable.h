@@ -0,0 +1,33 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Existence, type, readability and size of a set of paths, stat:ed
+ * concurrently up front so that later per-file queries do not each do
+ * blocking syscalls. Paths not prefetched are stat:ed on demand.
+ */
+
+#import <Foundation/Foundation.h>
+
+@interface FileMetadataTable : NSObject
+// stat paths not already in table. not safe to call concurrently with queries
+- (void)prefetchPaths:(NSArray *)paths;
+
+- (BOOL)fileExistsAtPath:(NSString *)path isDirectory:(BOOL *)isDirectory;
+- (BOOL)isReadableFileAtPath:(NSString *)path;
+// size of regular file, 0 otherwise
+- (unsigned long long)fileSizeAtPath:(NSString *)path;
+@end
@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "FileMetadataTable.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+// number of paths stat:ed per dispatch_apply iteration
+static const NSUInteger kStatBatchSize = 64;
+
+typedef struct {
+    BOOL exists;
+    BOOL isDirectory;
+    BOOL isReadable;
+    unsigned long long size;
+} FileMetadata;
+
+static FileMetadata file_metadata(NSString *path) {
+    FileMetadata metadata = {NO, NO, NO, 0};
+    // fileSystemRepresentation raises on empty string
+    if (path.length == 0) {
+        return metadata;
+    }
+
+    const char *fsPath = path.fileSystemRepresentation;
+    struct stat st;
+    if (stat(fsPath, &st) != 0) {
+        return metadata;
+    }
+
+    metadata.exists = YES;
+    metadata.isDirectory = S_ISDIR(st.st_mode);
+    // same check as NSFileManager isReadableFileAtPath:
+    metadata.isReadable = access(fsPath, R_OK) == 0;
+    if (S_ISREG(st.st_mode)) {
+        metadata.size = (unsigned long long)st.st_size;
+    }
+
+    return metadata;
+}
+
+@interface FileMetadataTable ()
+// path -> NSData with FileMetadata
+@property(nonatomic, strong, readwrite) NSMutableDictionary *metadatas;
+@end
+
+@implementation FileMetadataTable
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.metadatas = [NSMutableDictionary dictionary];
+
+    return self;
+}
+
+- (void)prefetchPaths:(NSArray *)paths {
+    NSMutableOrderedSet *newPathsSet = [NSMutableOrderedSet orderedSet];
+    for (NSString *path in paths) {
+        if (self.metadatas[path] == nil) {
+            [newPathsSet addObject:path];
+        }
+    }
+
+    NSArray *newPaths = [newPathsSet array];
+    NSUInteger count = newPaths.count;
+    if (count == 0) {
+        return;
+    }
+
+    FileMetadata *metadatas = calloc(count, sizeof(FileMetadata));
+
+    // stat in batches to not pay dispatch overhead per path
+    dispatch_apply((count + kStatBatchSize - 1) / kStatBatchSize,
+                   dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                   ^(size_t batch) {
+                       NSUInteger end = MIN((batch + 1) * kStatBatchSize, count);
+                       for (NSUInteger i = batch * kStatBatchSize; i < end; i++) {
+                           metadatas[i] = file_metadata(newPaths[i]);
+                       }
+                   });
+
+    for (NSUInteger i = 0; i < count; i++) {
+        self.metadatas[newPaths[i]] = [NSData dataWithBytes:&metadatas[i]
+                                                     length:sizeof(FileMetadata)];
+    }
+    free(metadatas);
+}
+
+- (FileMetadata)metadataForPath:(NSString *)path {
+    NSData *data = self.metadatas[path];
+    if (data == nil) {
+        // not prefetched, don't cache as the table is only mutated by prefetch
+        return file_metadata(path);
+    }
+
+    return *(const FileMetadata *)data.bytes;
+}
+
+- (BOOL)fileExistsAtPath:(NSString *)path isDirectory:(BOOL *)isDirectory {
+    FileMetadata metadata = [self metadataForPath:path];
+    if (isDirectory != NULL) {
+        *isDirectory = metadata.isDirectory;
+    }
+
+    return metadata.exists;
+}
+
+- (BOOL)isReadableFileAtPath:(NSString *)path {
+    return [self metadataForPath:path].isReadable;
+}
+
+- (unsigned long long)fileSizeAtPath:(NSString *)path {
+    return [self metadataForPath:path].size;
+}
+
+@end
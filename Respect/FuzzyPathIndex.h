@@ -0,0 +1,40 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * BK-tree over paths for case insensitive "did you mean" lookups. A query
+ * only computes edit distance to nodes whose subtree can contain a match,
+ * and each distance is banded to the largest distance that still matters
+ * so it gives up as soon as a row exceeds it.
+ */
+
+#import <Foundation/Foundation.h>
+
+// edit distance between a and b, or limit + 1 if larger than limit. rows
+// is scratch space for at least 2 * (blength + 2) elements
+NSUInteger RespectBoundedEditDistance(const unichar *a, NSUInteger alength,
+                                      const unichar *b, NSUInteger blength,
+                                      NSUInteger limit, NSUInteger *rows);
+
+@interface FuzzyPathIndex : NSObject
+@property(nonatomic, assign, readonly) NSUInteger count;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithPaths:(NSArray *)paths NS_DESIGNATED_INITIALIZER;
+// indexed paths within maxDistance of path ignoring case, nearest first then
+// sorted by path. not safe to call concurrently
+- (NSArray *)pathsNearPath:(NSString *)path maxDistance:(NSUInteger)maxDistance;
+@end
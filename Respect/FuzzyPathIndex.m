@@ -0,0 +1,244 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "FuzzyPathIndex.h"
+
+typedef struct {
+    // lowercased path in characters buffer
+    NSUInteger offset;
+    NSUInteger length;
+    NSUInteger pathIndex;
+    // distance to parent
+    NSUInteger edge;
+    NSUInteger maxChildEdge;
+    NSUInteger firstChild;
+    NSUInteger nextSibling;
+} FuzzyPathIndexNode;
+
+static const NSUInteger kNoNode = NSUIntegerMax;
+
+NSUInteger RespectBoundedEditDistance(const unichar *a, NSUInteger alength,
+                                      const unichar *b, NSUInteger blength,
+                                      NSUInteger limit, NSUInteger *rows) {
+    NSUInteger over = limit + 1;
+    if ((alength > blength ? alength - blength : blength - alength) > limit) {
+        return over;
+    }
+
+    NSUInteger *prev = rows;
+    NSUInteger *cur = rows + blength + 2;
+    for (NSUInteger j = 0; j <= blength; j++) {
+        prev[j] = j <= limit ? j : over;
+    }
+    prev[blength + 1] = over;
+
+    for (NSUInteger i = 1; i <= alength; i++) {
+        // only cells within limit of the diagonal can be within limit
+        NSUInteger lo = i > limit ? i - limit : 1;
+        NSUInteger hi = MIN(blength, i + limit);
+        cur[lo - 1] = lo == 1 && i <= limit ? i : over;
+        NSUInteger rowMin = cur[lo - 1];
+        unichar ac = a[i - 1];
+
+        for (NSUInteger j = lo; j <= hi; j++) {
+            NSUInteger d;
+            if (ac == b[j - 1]) {
+                d = prev[j - 1];
+            } else {
+                d = MIN(MIN(prev[j], cur[j - 1]), prev[j - 1]) + 1;
+            }
+            d = MIN(d, over);
+            cur[j] = d;
+            rowMin = MIN(rowMin, d);
+        }
+        cur[hi + 1] = over;
+
+        if (rowMin > limit) {
+            return over;
+        }
+
+        NSUInteger *t = prev;
+        prev = cur;
+        cur = t;
+    }
+
+    return MIN(prev[blength], over);
+}
+
+@interface FuzzyPathIndex ()
+@property(nonatomic, assign, readwrite) NSUInteger count;
+@property(nonatomic, copy, readwrite) NSArray *paths;
+@end
+
+@implementation FuzzyPathIndex {
+    unichar *_characters;
+    FuzzyPathIndexNode *_nodes;
+    NSUInteger *_rows;
+    NSUInteger _rowsCapacity;
+    NSUInteger *_stack;
+}
+
+- (instancetype)initWithPaths:(NSArray *)paths {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.paths = paths;
+    self.count = paths.count;
+
+    NSUInteger charactersLength = 0;
+    NSUInteger maxLength = 0;
+    NSMutableArray *lowercasePaths = [NSMutableArray arrayWithCapacity:paths.count];
+    for (NSString *path in paths) {
+        NSString *lowercasePath = path.lowercaseString;
+        [lowercasePaths addObject:lowercasePath];
+        charactersLength += lowercasePath.length;
+        maxLength = MAX(maxLength, lowercasePath.length);
+    }
+
+    _characters = malloc(sizeof(unichar) * MAX(charactersLength, 1));
+    _nodes = malloc(sizeof(FuzzyPathIndexNode) * MAX(self.count, 1));
+    _stack = malloc(sizeof(NSUInteger) * MAX(self.count, 1));
+    [self ensureRowsForLength:maxLength];
+
+    NSUInteger offset = 0;
+    for (NSUInteger i = 0; i < self.count; i++) {
+        NSString *lowercasePath = lowercasePaths[i];
+        NSUInteger length = lowercasePath.length;
+        [lowercasePath getCharacters:_characters + offset range:NSMakeRange(0, length)];
+        _nodes[i] = (FuzzyPathIndexNode){
+            .offset = offset,
+            .length = length,
+            .pathIndex = i,
+            .edge = 0,
+            .maxChildEdge = 0,
+            .firstChild = kNoNode,
+            .nextSibling = kNoNode};
+        offset += length;
+
+        if (i > 0) {
+            [self insertNode:i];
+        }
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_characters);
+    free(_nodes);
+    free(_rows);
+    free(_stack);
+}
+
+- (void)ensureRowsForLength:(NSUInteger)length {
+    if (length + 2 <= _rowsCapacity) {
+        return;
+    }
+
+    _rowsCapacity = length + 2;
+    free(_rows);
+    _rows = malloc(sizeof(NSUInteger) * 2 * _rowsCapacity);
+}
+
+- (void)insertNode:(NSUInteger)index {
+    FuzzyPathIndexNode *node = &_nodes[index];
+    const unichar *chars = _characters + node->offset;
+    NSUInteger parent = 0;
+
+    for (;;) {
+        FuzzyPathIndexNode *parentNode = &_nodes[parent];
+        // exact distance needed for the edge
+        NSUInteger distance = RespectBoundedEditDistance(chars, node->length,
+                                                         _characters + parentNode->offset,
+                                                         parentNode->length,
+                                                         MAX(node->length, parentNode->length),
+                                                         _rows);
+
+        NSUInteger child = parentNode->firstChild;
+        while (child != kNoNode && _nodes[child].edge != distance) {
+            child = _nodes[child].nextSibling;
+        }
+
+        if (child == kNoNode) {
+            node->edge = distance;
+            node->nextSibling = parentNode->firstChild;
+            parentNode->firstChild = index;
+            parentNode->maxChildEdge = MAX(parentNode->maxChildEdge, distance);
+            return;
+        }
+
+        parent = child;
+    }
+}
+
+- (NSArray *)pathsNearPath:(NSString *)path maxDistance:(NSUInteger)maxDistance {
+    if (self.count == 0) {
+        return @[];
+    }
+
+    NSString *lowercasePath = path.lowercaseString;
+    NSUInteger length = lowercasePath.length;
+    unichar *chars = malloc(sizeof(unichar) * MAX(length, 1));
+    [lowercasePath getCharacters:chars range:NSMakeRange(0, length)];
+
+    NSMutableArray *matches = [NSMutableArray array];
+    NSUInteger stackCount = 0;
+    _stack[stackCount++] = 0;
+
+    while (stackCount > 0) {
+        FuzzyPathIndexNode *node = &_nodes[_stack[--stackCount]];
+        [self ensureRowsForLength:node->length];
+        // beyond this no child can be within maxDistance so distance does not
+        // need to be exact
+        NSUInteger limit = node->maxChildEdge + maxDistance;
+        NSUInteger distance = RespectBoundedEditDistance(chars, length,
+                                                         _characters + node->offset,
+                                                         node->length,
+                                                         limit, _rows);
+        if (distance <= maxDistance) {
+            [matches addObject:@[@(distance), self.paths[node->pathIndex]]];
+        }
+
+        for (NSUInteger child = node->firstChild;
+             child != kNoNode;
+             child = _nodes[child].nextSibling) {
+            NSUInteger edge = _nodes[child].edge;
+            if (edge + maxDistance >= distance && edge <= distance + maxDistance) {
+                _stack[stackCount++] = child;
+            }
+        }
+    }
+    free(chars);
+
+    [matches sortUsingComparator:^NSComparisonResult(NSArray *a, NSArray *b) {
+        NSComparisonResult r = [a[0] compare:b[0]];
+        if (r == NSOrderedSame) {
+            r = [a[1] compare:b[1]];
+        }
+        return r;
+    }];
+
+    NSMutableArray *paths = [NSMutableArray arrayWithCapacity:matches.count];
+    for (NSArray *match in matches) {
+        [paths addObject:match[1]];
+    }
+
+    return paths;
+}
+
+@end
@@ -119,7 +119,7 @@
         return existinSuggestions.lastObject;
     }
     
-    return nil;
+    return [self.linter suggestedBundleResourcePathForPath:resourcePath];
 }
 
 - (NSArray *)configLines {
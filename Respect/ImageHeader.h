@@ -0,0 +1,34 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Reads pixel size from PNG, JPEG and GIF headers without decoding the
+ * image. Files are mapped so only the pages containing the header are read.
+ */
+
+@interface ImageHeader : NSObject
+@property(nonatomic, assign, readonly) NSUInteger pixelWidth;
+@property(nonatomic, assign, readonly) NSUInteger pixelHeight;
+
+// nil if not a PNG, JPEG or GIF or if header is truncated
++ (instancetype)imageHeaderWithContentsOfFile:(NSString *)path;
++ (instancetype)imageHeaderWithBytes:(const uint8_t *)bytes
+                              length:(NSUInteger)length;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithPixelWidth:(NSUInteger)pixelWidth
+                       pixelHeight:(NSUInteger)pixelHeight NS_DESIGNATED_INITIALIZER;
+@end
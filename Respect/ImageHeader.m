@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "ImageHeader.h"
+
+static uint16_t read_be16(const uint8_t *p) {
+    return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+static uint32_t read_be32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static uint16_t read_le16(const uint8_t *p) {
+    return (uint16_t)(p[1] << 8 | p[0]);
+}
+
+static BOOL png_size(const uint8_t *bytes, NSUInteger length,
+                     NSUInteger *width, NSUInteger *height) {
+    static const uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    if (length < sizeof(signature) || memcmp(bytes, signature, sizeof(signature)) != 0) {
+        return NO;
+    }
+
+    NSUInteger offset = sizeof(signature);
+    // chunk is length, type, data and crc. Xcode crushed PNGs have a CgBI
+    // chunk before IHDR
+    for (int i = 0; i < 2; i++) {
+        if (offset + 8 > length) {
+            return NO;
+        }
+        uint32_t chunkLength = read_be32(bytes + offset);
+        const uint8_t *chunkType = bytes + offset + 4;
+
+        if (memcmp(chunkType, "IHDR", 4) == 0) {
+            if (chunkLength < 8 || offset + 16 > length) {
+                return NO;
+            }
+            *width = read_be32(bytes + offset + 8);
+            *height = read_be32(bytes + offset + 12);
+            return YES;
+        } else if (memcmp(chunkType, "CgBI", 4) != 0) {
+            return NO;
+        }
+
+        offset += 12 + (NSUInteger)chunkLength;
+    }
+
+    return NO;
+}
+
+static BOOL gif_size(const uint8_t *bytes, NSUInteger length,
+                     NSUInteger *width, NSUInteger *height) {
+    if (length < 10 ||
+        (memcmp(bytes, "GIF87a", 6) != 0 && memcmp(bytes, "GIF89a", 6) != 0)) {
+        return NO;
+    }
+
+    *width = read_le16(bytes + 6);
+    *height = read_le16(bytes + 8);
+    return YES;
+}
+
+static BOOL jpeg_size(const uint8_t *bytes, NSUInteger length,
+                      NSUInteger *width, NSUInteger *height) {
+    if (length < 2 || bytes[0] != 0xff || bytes[1] != 0xd8) {
+        return NO;
+    }
+
+    NSUInteger offset = 2;
+    while (offset < length) {
+        if (bytes[offset] != 0xff) {
+            return NO;
+        }
+        // skip fill bytes
+        while (offset < length && bytes[offset] == 0xff) {
+            offset++;
+        }
+        if (offset >= length) {
+            return NO;
+        }
+
+        uint8_t marker = bytes[offset++];
+        // markers without segment data
+        if (marker == 0x01 || (marker >= 0xd0 && marker <= 0xd8)) {
+            continue;
+        }
+        // no frame header before scan or end of image
+        if (marker == 0xd9 || marker == 0xda || offset + 2 > length) {
+            return NO;
+        }
+
+        uint16_t segmentLength = read_be16(bytes + offset);
+        if (segmentLength < 2) {
+            return NO;
+        }
+
+        // SOF0-SOF15 except DHT, JPG and DAC
+        if (marker >= 0xc0 && marker <= 0xcf &&
+            marker != 0xc4 && marker != 0xc8 && marker != 0xcc) {
+            // length, precision, height and width
+            if (segmentLength < 7 || offset + 7 > length) {
+                return NO;
+            }
+            *height = read_be16(bytes + offset + 3);
+            *width = read_be16(bytes + offset + 5);
+            return YES;
+        }
+
+        offset += segmentLength;
+    }
+
+    return NO;
+}
+
+@interface ImageHeader ()
+@property(nonatomic, assign, readwrite) NSUInteger pixelWidth;
+@property(nonatomic, assign, readwrite) NSUInteger pixelHeight;
+@end
+
+@implementation ImageHeader
+
++ (instancetype)imageHeaderWithContentsOfFile:(NSString *)path {
+    NSData *data = [NSData dataWithContentsOfFile:path
+                                          options:NSDataReadingMappedIfSafe
+                                            error:NULL];
+    if (data == nil) {
+        return nil;
+    }
+
+    return [self imageHeaderWithBytes:data.bytes length:data.length];
+}
+
++ (instancetype)imageHeaderWithBytes:(const uint8_t *)bytes
+                              length:(NSUInteger)length {
+    NSUInteger width = 0;
+    NSUInteger height = 0;
+
+    if (!png_size(bytes, length, &width, &height) &&
+        !jpeg_size(bytes, length, &width, &height) &&
+        !gif_size(bytes, length, &width, &height)) {
+        return nil;
+    }
+
+    return [[self alloc] initWithPixelWidth:width pixelHeight:height];
+}
+
+- (instancetype)initWithPixelWidth:(NSUInteger)pixelWidth
+                       pixelHeight:(NSUInteger)pixelHeight {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.pixelWidth = pixelWidth;
+    self.pixelHeight = pixelHeight;
+
+    return self;
+}
+
+@end
@@ -0,0 +1,37 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Finds the paths of #import "..." and #include "..." directives by looking
+ * only at lines whose first non-blank character is #. Directives inside
+ * comments and in disabled #if 0 blocks are skipped.
+ *
+ * With honorDefines, #ifdef, #ifndef and defined() are also evaluated for
+ * macros #define:ed earlier in the same text. Macros not seen could be
+ * defined by build settings so both branches are scanned for them.
+ */
+
+#import <Foundation/Foundation.h>
+#import "ScratchArena.h"
+
+@interface IncludeScanner : NSObject
++ (NSArray *)quotedIncludePathsInText:(NSString *)text honorDefines:(BOOL)honorDefines;
+// same as above but text bytes and #if stack are allocated in arena which
+// caller resets when done
++ (NSArray *)quotedIncludePathsInText:(NSString *)text
+                         honorDefines:(BOOL)honorDefines
+                         scratchArena:(ScratchArena *)arena;
+@end
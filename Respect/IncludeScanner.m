@@ -0,0 +1,336 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "IncludeScanner.h"
+
+typedef NS_ENUM(NSInteger, IncludeScannerCondition) {
+    IncludeScannerConditionFalse,
+    IncludeScannerConditionTrue,
+    IncludeScannerConditionUnknown
+};
+
+typedef struct {
+    BOOL parentActive;
+    BOOL parentCertain;
+    BOOL active;
+    // branch is definitely taken, defines in it always happen
+    BOOL certain;
+    // a previous branch was definitely taken so following are inactive
+    BOOL taken;
+    // a previous branch might have been taken
+    BOOL maybeTaken;
+    // NAME if first branch is #ifndef NAME or #if !defined(NAME), NULL
+    // otherwise. a #define NAME in it is defined after the branch either way
+    const char *guardStart;
+    const char *guardEnd;
+} IncludeScannerFrame;
+
+static BOOL is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+static BOOL is_ident(char c) {
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9') || c == '_');
+}
+
+static const char *skip_blanks(const char *p, const char *end) {
+    while (p < end && is_blank(*p)) {
+        p++;
+    }
+
+    return p;
+}
+
+static const char *skip_ident(const char *p, const char *end) {
+    while (p < end && is_ident(*p)) {
+        p++;
+    }
+
+    return p;
+}
+
+// skip string and char literals and comments in line, sets inBlockComment if
+// line ends inside a block comment. returns start of first comment or end
+static const char *scan_comments(const char *p, const char *end, BOOL *inBlockComment) {
+    const char *commentStart = end;
+
+    while (p < end) {
+        if (*inBlockComment) {
+            const char *close = NULL;
+            for (const char *s = p; s + 1 < end; s++) {
+                if (s[0] == '*' && s[1] == '/') {
+                    close = s;
+                    break;
+                }
+            }
+            if (close == NULL) {
+                return commentStart;
+            }
+            *inBlockComment = NO;
+            p = close + 2;
+            continue;
+        }
+
+        // most lines have no comment or literal
+        const char *next = p;
+        while (next < end && *next != '/' && *next != '"' && *next != '\'') {
+            next++;
+        }
+        if (next == end) {
+            break;
+        }
+
+        if (*next == '"' || *next == '\'') {
+            char quote = *next;
+            p = next + 1;
+            while (p < end && *p != quote) {
+                p += *p == '\\' ? 2 : 1;
+            }
+            p = MIN(p + 1, end);
+        } else if (next + 1 < end && next[1] == '/') {
+            return MIN(commentStart, next);
+        } else if (next + 1 < end && next[1] == '*') {
+            commentStart = MIN(commentStart, next);
+            *inBlockComment = YES;
+            p = next + 2;
+        } else {
+            p = next + 1;
+        }
+    }
+
+    return commentStart;
+}
+
+static NSString *string_from_range(const char *start, const char *end) {
+    return [[NSString alloc] initWithBytes:start
+                                    length:(NSUInteger)(end - start)
+                                  encoding:NSUTF8StringEncoding];
+}
+
+// guardStart and guardEnd are set to NAME for !defined NAME if not NULL
+static IncludeScannerCondition evaluate_condition(const char *p, const char *end,
+                                                  NSSet *definedMacros,
+                                                  const char **guardStart,
+                                                  const char **guardEnd) {
+    p = skip_blanks(p, end);
+    while (end > p && is_blank(end[-1])) {
+        end--;
+    }
+
+    if (end - p == 1 && *p == '0') {
+        return IncludeScannerConditionFalse;
+    } else if (end - p == 1 && *p == '1') {
+        return IncludeScannerConditionTrue;
+    } else if (definedMacros == nil) {
+        return IncludeScannerConditionUnknown;
+    }
+
+    // [!]defined NAME or [!]defined(NAME)
+    BOOL negate = NO;
+    if (p < end && *p == '!') {
+        negate = YES;
+        p = skip_blanks(p + 1, end);
+    }
+    const char *keywordEnd = skip_ident(p, end);
+    if (!(keywordEnd - p == 7 && strncmp(p, "defined", 7) == 0)) {
+        return IncludeScannerConditionUnknown;
+    }
+    p = skip_blanks(keywordEnd, end);
+    BOOL parenthesized = p < end && *p == '(';
+    if (parenthesized) {
+        p = skip_blanks(p + 1, end);
+    }
+    const char *nameEnd = skip_ident(p, end);
+    const char *rest = skip_blanks(nameEnd, end);
+    if (parenthesized) {
+        if (!(rest < end && *rest == ')')) {
+            return IncludeScannerConditionUnknown;
+        }
+        rest = skip_blanks(rest + 1, end);
+    }
+    if (nameEnd == p || rest != end) {
+        return IncludeScannerConditionUnknown;
+    }
+    if (negate && guardStart != NULL) {
+        *guardStart = p;
+        *guardEnd = nameEnd;
+    }
+    if (![definedMacros containsObject:string_from_range(p, nameEnd)]) {
+        return IncludeScannerConditionUnknown;
+    }
+
+    return negate ? IncludeScannerConditionFalse : IncludeScannerConditionTrue;
+}
+
+@implementation IncludeScanner
+
++ (NSArray *)quotedIncludePathsInText:(NSString *)text honorDefines:(BOOL)honorDefines {
+    ScratchArena *arena = ScratchArenaCreate(text.length + 1024);
+    NSArray *paths = [self quotedIncludePathsInText:text
+                                       honorDefines:honorDefines
+                                       scratchArena:arena];
+    ScratchArenaDestroy(arena);
+
+    return paths;
+}
+
++ (NSArray *)quotedIncludePathsInText:(NSString *)text
+                         honorDefines:(BOOL)honorDefines
+                         scratchArena:(ScratchArena *)arena {
+    NSMutableArray *paths = [NSMutableArray array];
+    NSMutableSet *definedMacros = honorDefines ? [NSMutableSet set] : nil;
+
+    // copy into arena instead of UTF8String that would allocate an
+    // autoreleased buffer for each file
+    NSUInteger maxLength = [text lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    char *bytes = ScratchArenaAlloc(arena, maxLength);
+    NSUInteger length = 0;
+    if (![text getBytes:bytes
+              maxLength:maxLength
+             usedLength:&length
+               encoding:NSUTF8StringEncoding
+                options:0
+                  range:NSMakeRange(0, text.length)
+         remainingRange:NULL]) {
+        return paths;
+    }
+    const char *textEnd = bytes + length;
+
+    NSUInteger framesCapacity = 16;
+    NSUInteger framesCount = 0;
+    IncludeScannerFrame *frames = ScratchArenaAlloc(arena,
+                                                    sizeof(IncludeScannerFrame) * framesCapacity);
+    BOOL inBlockComment = NO;
+
+    const char *line = bytes;
+    while (line < textEnd) {
+        const char *lineEnd = memchr(line, '\n', (size_t)(textEnd - line)) ?: textEnd;
+        const char *next = lineEnd < textEnd ? lineEnd + 1 : textEnd;
+
+        const char *p = skip_blanks(line, lineEnd);
+        if (inBlockComment || p == lineEnd || *p != '#') {
+            scan_comments(p, lineEnd, &inBlockComment);
+            line = next;
+            continue;
+        }
+
+        // directive arguments end at first comment
+        const char *end = scan_comments(p + 1, lineEnd, &inBlockComment);
+        const char *nameStart = skip_blanks(p + 1, end);
+        const char *nameEnd = skip_ident(nameStart, end);
+        size_t nameLength = (size_t)(nameEnd - nameStart);
+        const char *args = skip_blanks(nameEnd, end);
+        BOOL active = framesCount == 0 || frames[framesCount - 1].active;
+        BOOL certain = framesCount == 0 || frames[framesCount - 1].certain;
+
+#define DIRECTIVE_IS(s) (nameLength == sizeof(s) - 1 && strncmp(nameStart, s, nameLength) == 0)
+        if (DIRECTIVE_IS("if") || DIRECTIVE_IS("ifdef") || DIRECTIVE_IS("ifndef")) {
+            IncludeScannerCondition condition = IncludeScannerConditionUnknown;
+            const char *guardStart = NULL;
+            const char *guardEnd = NULL;
+            if (DIRECTIVE_IS("if")) {
+                condition = evaluate_condition(args, end, definedMacros,
+                                               &guardStart, &guardEnd);
+            } else if (definedMacros != nil) {
+                const char *macroEnd = skip_ident(args, end);
+                if (DIRECTIVE_IS("ifndef") && macroEnd > args) {
+                    guardStart = args;
+                    guardEnd = macroEnd;
+                }
+                if ([definedMacros containsObject:string_from_range(args, macroEnd)]) {
+                    condition = (DIRECTIVE_IS("ifdef") ?
+                                 IncludeScannerConditionTrue :
+                                 IncludeScannerConditionFalse);
+                }
+            }
+
+            if (framesCount == framesCapacity) {
+                frames = ScratchArenaRealloc(arena, frames,
+                                             sizeof(IncludeScannerFrame) * framesCapacity,
+                                             sizeof(IncludeScannerFrame) * framesCapacity * 2);
+                framesCapacity *= 2;
+            }
+            frames[framesCount++] = (IncludeScannerFrame){
+                .parentActive = active,
+                .parentCertain = certain,
+                .active = active && condition != IncludeScannerConditionFalse,
+                .certain = certain && condition == IncludeScannerConditionTrue,
+                .taken = condition == IncludeScannerConditionTrue,
+                .maybeTaken = condition == IncludeScannerConditionUnknown,
+                .guardStart = guardStart,
+                .guardEnd = guardEnd};
+        } else if (DIRECTIVE_IS("elif") && framesCount > 0) {
+            IncludeScannerFrame *frame = &frames[framesCount - 1];
+            IncludeScannerCondition condition = evaluate_condition(args, end, definedMacros,
+                                                                   NULL, NULL);
+            frame->active = (frame->parentActive && !frame->taken &&
+                             condition != IncludeScannerConditionFalse);
+            frame->certain = (frame->parentCertain && !frame->taken && !frame->maybeTaken &&
+                              condition == IncludeScannerConditionTrue);
+            frame->taken = frame->taken || condition == IncludeScannerConditionTrue;
+            frame->maybeTaken = frame->maybeTaken || condition == IncludeScannerConditionUnknown;
+            frame->guardStart = NULL;
+        } else if (DIRECTIVE_IS("else") && framesCount > 0) {
+            IncludeScannerFrame *frame = &frames[framesCount - 1];
+            frame->active = frame->parentActive && !frame->taken;
+            frame->certain = frame->parentCertain && !frame->taken && !frame->maybeTaken;
+            frame->taken = YES;
+            frame->guardStart = NULL;
+        } else if (DIRECTIVE_IS("endif") && framesCount > 0) {
+            framesCount--;
+        } else if (!active) {
+            // skip disabled define and include
+        } else if (DIRECTIVE_IS("define") || DIRECTIVE_IS("undef")) {
+            const char *macroEnd = skip_ident(args, end);
+            if (definedMacros != nil && macroEnd > args) {
+                NSString *macro = string_from_range(args, macroEnd);
+                // include guard defines its name whether the branch was
+                // taken or not
+                IncludeScannerFrame *frame = framesCount > 0 ? &frames[framesCount - 1] : NULL;
+                BOOL isGuard = (frame != NULL && frame->parentCertain &&
+                                frame->guardStart != NULL &&
+                                (size_t)(frame->guardEnd - frame->guardStart) ==
+                                (size_t)(macroEnd - args) &&
+                                strncmp(frame->guardStart, args,
+                                        (size_t)(macroEnd - args)) == 0);
+                if (DIRECTIVE_IS("define") && (certain || isGuard)) {
+                    [definedMacros addObject:macro];
+                } else {
+                    // undefined or maybe defined, conditions using it are
+                    // unknown
+                    [definedMacros removeObject:macro];
+                }
+            }
+        } else if ((DIRECTIVE_IS("import") || DIRECTIVE_IS("include")) &&
+                   args < end && *args == '"') {
+            const char *quoteEnd = memchr(args + 1, '"', (size_t)(end - args - 1));
+            if (quoteEnd != NULL) {
+                NSString *path = string_from_range(args + 1, quoteEnd);
+                if (path != nil) {
+                    [paths addObject:path];
+                }
+            }
+        }
+#undef DIRECTIVE_IS
+
+        line = next;
+    }
+
+    return paths;
+}
+
+@end
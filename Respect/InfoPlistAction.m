@@ -23,6 +23,7 @@
 #import "ImageAction.h"
 #import "NSString+Respect.h"
 #import "NSArray+Respect.h"
+#import "ResourceContentPrefetcher.h"
 
 // main idea is that images are required if they are explicitly referenced in Info.plist
 
@@ -38,6 +39,17 @@ static NSString * const InfoPlistKeyCFBundleIcons = @"CFBundleIcons";
 static NSString * const InfoPlistKeyCFBundlePrimaryIcon = @"CFBundlePrimaryIcon";
 static NSString * const InfoPlistKeyUINewsstandIcon = @"UINewsstandIcon";
 
+static ResourceContentParseBlock infoPlistParseBlock = ^id(NSString *path, NSString **errorMessage) {
+    NSDictionary *infoPlist = [NSDictionary dictionaryWithContentsOfFile:path];
+    if (infoPlist == nil ||
+        ![infoPlist isKindOfClass:[NSDictionary class]]) {
+        *errorMessage = @"Failed to parse Info.plist";
+        return nil;
+    }
+
+    return infoPlist;
+};
+
 @interface InfoPlistAction ()
 @property(nonatomic, strong, readwrite) ImageNamedFinder *imageNamedFinder;
 @end
@@ -51,23 +63,11 @@ static NSString * const InfoPlistKeyUINewsstandIcon = @"UINewsstandIcon";
 - (void)addResourcePath:(NSString *)resourcePath
           referencePath:(NSString *)referencePath
           referenceHint:(NSString *)referenceHint {
-    ResourceReference *resourceRef = [[ResourceReference alloc]
-                                       initWithResourcePath:resourcePath
-                                       referencePath:referencePath
-                                       referenceLocation:MakeTextLineLocation(1)
-                                       referenceHint:referenceHint
-                                       missingResourceHint:
-                                       // TODO: image smartness?
-                                       [self actionMissingResourceHint:resourcePath]];
-    [self.linter.resourceReferences addObject:resourceRef];
-    
-    BundleResource *bundleRes = self.linter.bundleResources[resourcePath];
-    if (bundleRes == nil) {
-        return;
-    }
-    
-    [bundleRes.resourceReferences addObject:resourceRef];
-    [resourceRef.bundleResources addObject:bundleRes];
+    // TODO: image smartness for missing resource hint?
+    [self addReferenceToResourcePath:resourcePath
+                       referencePath:referencePath
+                   referenceLocation:MakeTextLineLocation(1)
+                       referenceHint:referenceHint];
 }
 
 - (void)addNamed:(NSString *)name
@@ -259,12 +259,15 @@ static NSString * const InfoPlistKeyUINewsstandIcon = @"UINewsstandIcon";
 }
 
 - (void)parseInfoPlistAtPath:(NSString *)path {
-    NSDictionary *infoPlist = [NSDictionary dictionaryWithContentsOfFile:path];
-    if (infoPlist == nil ||
-        ![infoPlist isKindOfClass:[NSDictionary class]]) {
+    NSString *errorMessage = nil;
+    NSDictionary *infoPlist = [self.linter.contentPrefetcher
+                               contentOfPath:path
+                               parseBlock:infoPlistParseBlock
+                               errorMessage:&errorMessage];
+    if (infoPlist == nil) {
         [self.linter.lintErrors addObject:
          [LintError lintErrorWithFile:path
-                              message:@"Failed to parse Info.plist"]];
+                              message:errorMessage]];
         return;
     }
     
@@ -316,6 +319,18 @@ static NSString * const InfoPlistKeyUINewsstandIcon = @"UINewsstandIcon";
     return foundPaths;
 }
 
+- (void)prefetchResourceContent {
+    for (NSString *resourcePath in [self staticResourcePaths]) {
+        BundleResource *bundleRes = self.linter.bundleResources[resourcePath];
+        if (![bundleRes.buildSourcePath.pathExtension isEqualToString:@"plist"]) {
+            continue;
+        }
+
+        [self.linter.contentPrefetcher prefetchContentOfPath:bundleRes.buildSourcePath
+                                                  parseBlock:infoPlistParseBlock];
+    }
+}
+
 - (void)actionForMatchedBundleResource:(BundleResource *)bundleRes {
     if (![(bundleRes.buildSourcePath).pathExtension isEqualToString:@"plist"]) {
         return;
@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * A project read once and linted any number of times, for the respect
+ * tool and for tools keeping a linter around between lints. Sources read
+ * are cached until reported as changed.
+ */
+
+#import "ResourceLinter.h"
+#import "PBXProject.h"
+#import "TextFileCache.h"
+
+@interface LintSession : NSObject
+@property(nonatomic, strong, readonly) PBXProject *pbxProject;
+@property(nonatomic, strong, readonly) TextFileCache *textFileCache;
+
++ (instancetype)sessionWithProjectPath:(NSString *)path error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+// textFileCache can be shared between sessions for projects in a workspace
+- (instancetype)initWithPBXProject:(PBXProject *)pbxProject
+                     textFileCache:(TextFileCache *)textFileCache NS_DESIGNATED_INITIALIZER;
+
+// prepare project for target and configuration, read sources and lint.
+// environment is looked up before the fallback build environment, see
+// ResourceLinter for the shard arguments and delegate
+- (ResourceLinter *)lintNativeTarget:(PBXNativeTarget *)nativeTarget
+                  buildConfiguration:(XCBuildConfiguration *)buildConfiguration
+                         environment:(NSDictionary *)environment
+                          configPath:(NSString *)configPath
+                  parseDefaultConfig:(BOOL)parseDefaultConfig
+                             options:(ResourceLinterOptions)options
+                      spFeaturesPath:(NSString *)spFeaturesPath
+                          shardIndex:(NSUInteger)shardIndex
+                          shardCount:(NSUInteger)shardCount
+                           shardRuns:(NSArray *)shardRuns
+                            delegate:(id<ResourceLinterDelegate>)delegate
+                               error:(NSError **)error;
+// forget cached content of changed files, relative paths are resolved against
+// the current directory. the project is read again if its project file or a
+// xcconfig file changed, PBXNativeTarget and XCBuildConfiguration of the old
+// project should not be used after that
+- (BOOL)reloadChangedPaths:(NSArray *)paths error:(NSError **)error;
+@end
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "LintSession.h"
+#import "ResourceLinterXcodeProjectSource.h"
+#import "StageTimings.h"
+#import "NSString+Respect.h"
+
+@interface LintSession ()
+@property(nonatomic, strong, readwrite) PBXProject *pbxProject;
+@property(nonatomic, strong, readwrite) TextFileCache *textFileCache;
+@end
+
+@implementation LintSession
+
++ (instancetype)sessionWithProjectPath:(NSString *)path error:(NSError **)error {
+    PBXProject *pbxProject = [PBXProject pbxProjectFromPath:path error:error];
+    if (pbxProject == nil) {
+        return nil;
+    }
+
+    return [[self alloc] initWithPBXProject:pbxProject
+                              textFileCache:[[TextFileCache alloc] init]];
+}
+
+- (instancetype)initWithPBXProject:(PBXProject *)pbxProject
+                     textFileCache:(TextFileCache *)textFileCache {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.pbxProject = pbxProject;
+    self.textFileCache = textFileCache;
+
+    return self;
+}
+
+- (ResourceLinter *)lintNativeTarget:(PBXNativeTarget *)nativeTarget
+                  buildConfiguration:(XCBuildConfiguration *)buildConfiguration
+                         environment:(NSDictionary *)environment
+                          configPath:(NSString *)configPath
+                  parseDefaultConfig:(BOOL)parseDefaultConfig
+                             options:(ResourceLinterOptions)options
+                      spFeaturesPath:(NSString *)spFeaturesPath
+                          shardIndex:(NSUInteger)shardIndex
+                          shardCount:(NSUInteger)shardCount
+                           shardRuns:(NSArray *)shardRuns
+                            delegate:(id<ResourceLinterDelegate>)delegate
+                               error:(NSError **)error {
+    StageTimings *timings = [StageTimings sharedTimings];
+
+    // prepare sets up fallback build environment used if a variable can't be found in
+    // the normal environment which normally is based on the current process environment.
+    // this it to support running from CLI where Xcode has not exported things for us.
+    // prepare also takes care of loading xcconfig files.
+    [timings startStage:@"project"];
+    if (![self.pbxProject prepareWithEnvironment:environment
+                                    nativeTarget:nativeTarget
+                              buildConfiguration:buildConfiguration
+                                           error:error]) {
+        return nil;
+    }
+    [timings stopStage:@"project"];
+
+    [timings startStage:@"source"];
+    ResourceLinterXcodeProjectSource *projectSource = [[ResourceLinterXcodeProjectSource alloc]
+                                                       initWithPBXProject:self.pbxProject
+                                                       nativeTarget:nativeTarget
+                                                       buildConfiguration:buildConfiguration
+                                                       textFileCache:self.textFileCache];
+    if (spFeaturesPath != nil) {
+        [projectSource addSpotifyFeaturesAtPath:spFeaturesPath];
+    }
+    [timings stopStage:@"source"];
+
+    return [[ResourceLinter alloc] initWithResourceLinterSource:projectSource
+                                                     configPath:configPath
+                                             parseDefaultConfig:parseDefaultConfig
+                                                        options:options
+                                                     shardIndex:shardIndex
+                                                     shardCount:shardCount
+                                                      shardRuns:shardRuns
+                                                       delegate:delegate];
+}
+
+- (BOOL)reloadChangedPaths:(NSArray *)paths error:(NSError **)error {
+    NSString *currentDirectory = [[NSFileManager defaultManager] currentDirectoryPath];
+    NSString *pbxFilePath = [self.pbxProject.pbxFilePath
+                             respect_stringByResolvingPathRealtiveTo:
+                             currentDirectory].stringByStandardizingPath;
+    NSMutableArray *standardizedPaths = [NSMutableArray arrayWithCapacity:paths.count];
+    BOOL projectChanged = NO;
+    for (NSString *path in paths) {
+        // relative paths are relative to the current directory
+        NSString *standardizedPath = [path respect_stringByResolvingPathRealtiveTo:
+                                      currentDirectory].stringByStandardizingPath;
+        [standardizedPaths addObject:standardizedPath];
+        projectChanged = (projectChanged ||
+                          [standardizedPath isEqualToString:pbxFilePath] ||
+                          [standardizedPath.pathExtension isEqualToString:@"xcconfig"]);
+    }
+    // cache keys are build paths which are usually but not always standardized
+    [self.textFileCache removeTextFilesForPaths:
+     [paths arrayByAddingObjectsFromArray:standardizedPaths]];
+
+    if (!projectChanged) {
+        return YES;
+    }
+
+    PBXProject *pbxProject = [PBXProject pbxProjectFromPath:self.pbxProject.pbxFilePath
+                                                      error:error];
+    if (pbxProject == nil) {
+        return NO;
+    }
+    self.pbxProject = pbxProject;
+
+    return YES;
+}
+
+@end
@@ -83,4 +83,28 @@
 // '\t\r\n a \n\r\t' -> 'a'
 - (NSString *)respect_stringByTrimmingWhitespace;
 
+// "A10" -> <61 30 02 31 30> case folded and digit runs prefixed by length so
+// that comparing keys bytewise orders like NSCaseInsensitiveSearch|NSNumericSearch
+// nil if not ASCII
+- (NSData *)respect_sortKey;
+
 @end
+
+// compare using sort keys, falls back to compare:options: if a key is nil or
+// the keys are equal, ex: "1" and "01"
+NS_INLINE NSComparisonResult RespectCompareUsingSortKeys(NSString *a, NSData *aKey,
+                                                         NSString *b, NSData *bKey) {
+    if (aKey != nil && bKey != nil) {
+        NSUInteger aLength = aKey.length;
+        NSUInteger bLength = bKey.length;
+        int r = memcmp(aKey.bytes, bKey.bytes, MIN(aLength, bLength));
+        if (r != 0) {
+            return r < 0 ? NSOrderedAscending : NSOrderedDescending;
+        }
+        if (aLength != bLength) {
+            return aLength < bLength ? NSOrderedAscending : NSOrderedDescending;
+        }
+    }
+
+    return [a compare:b options:NSCaseInsensitiveSearch|NSNumericSearch];
+}
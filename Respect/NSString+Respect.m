@@ -18,6 +18,8 @@
 #import "NSString+Respect.h"
 #import "NSArray+Respect.h"
 #import "NSString+withFnmatch.h"
+#import "ParameterTemplate.h"
+#import "FuzzyPathIndex.h"
 
 @implementation NSString (Respect)
 
@@ -128,32 +130,9 @@
 }
 
 - (NSString *)respect_stringByReplacingParameters:(NSArray *)parameters {
-    NSMutableString *replaced = [NSMutableString stringWithString:self];
-    NSUInteger displace = 0;
-
-    NSRegularExpression *re = [NSRegularExpression
-                               regularExpressionWithPattern:@"\\$(\\d+)"
-                               options:0
-                               error:NULL];
-    NSArray *results = [re matchesInString:self
-                                   options:0
-                                     range:NSMakeRange(0, self.length)];
-    for (NSTextCheckingResult *result in results) {
-        NSRange r = result.range;
-        NSString *paramString = [self substringWithRange:[result rangeAtIndex:1]];
-        NSUInteger paramNumber = paramString.intValue;
-        if (paramNumber >= parameters.count) {
-            continue;
-        }
-
-        NSString *replacement = parameters[paramNumber];
-
-        r.location -= displace;
-        [replaced replaceCharactersInRange:r withString:replacement];
-        displace += r.length - replacement.length;
-    }
-
-    return replaced;
+    // use a ParameterTemplate directly if the same string is expanded repeatedly
+    return [[ParameterTemplate templateWithString:self]
+            stringByReplacingParameters:parameters];
 }
 
 + (void)respect_permutationsCollectWithParts:(NSArray *)parts
@@ -246,29 +225,17 @@
 - (NSUInteger)respect_levenshteinDistanceToString:(NSString *)string {
     NSUInteger sl = self.length;
     NSUInteger tl = string.length;
-    NSUInteger *d = calloc(sizeof(*d), (sl+1) * (tl+1));
-
-#define d(i, j) d[((j) * sl) + (i)]
-    for (NSUInteger i = 0; i <= sl; i++) {
-        d(i, 0) = i;
-    }
-    for (NSUInteger j = 0; j <= tl; j++) {
-        d(0, j) = j;
-    }
-    for (NSUInteger j = 1; j <= tl; j++) {
-        for (NSUInteger i = 1; i <= sl; i++) {
-            if ([self characterAtIndex:i-1] == [string characterAtIndex:j-1]) {
-                d(i, j) = d(i-1, j-1);
-            } else {
-                d(i, j) = MIN(d(i-1, j), MIN(d(i, j-1), d(i-1, j-1))) + 1;
-            }
-        }
-    }
+    unichar *s = malloc(sizeof(unichar) * (sl + tl + 1));
+    unichar *t = s + sl;
+    NSUInteger *rows = malloc(sizeof(NSUInteger) * 2 * (tl + 2));
+    [self getCharacters:s range:NSMakeRange(0, sl)];
+    [string getCharacters:t range:NSMakeRange(0, tl)];
 
-    NSUInteger r = d(sl, tl);
-#undef d
+    // distance can not be more than the longest length so this is exact
+    NSUInteger r = RespectBoundedEditDistance(s, sl, t, tl, MAX(sl, tl), rows);
 
-    free(d);
+    free(s);
+    free(rows);
 
     return r;
 }
@@ -374,4 +341,54 @@
             [NSCharacterSet whitespaceAndNewlineCharacterSet]];
 }
 
+- (NSData *)respect_sortKey {
+    const char *s = [self cStringUsingEncoding:NSASCIIStringEncoding];
+    if (s == NULL) {
+        return nil;
+    }
+
+    NSMutableData *key = [NSMutableData dataWithCapacity:self.length + 8];
+
+    while (*s != '\0') {
+        if (!isdigit(*s)) {
+            char c = (char)tolower(*s);
+            [key appendBytes:&c length:1];
+            s++;
+            continue;
+        }
+
+        // skip leading zeros, numbers with same value but different zero
+        // padding get equal keys
+        while (*s == '0' && isdigit(*(s+1))) {
+            s++;
+        }
+
+        const char *digits = s;
+        while (isdigit(*s)) {
+            s++;
+        }
+
+        // '0' keeps the run ordered like a digit against other characters,
+        // then length so that shorter numbers are smaller. length is one byte
+        // or 255 followed by 8 bytes big endian so long runs sort after
+        // shorter ones
+        NSUInteger length = s - digits;
+        const char marker = '0';
+        [key appendBytes:&marker length:1];
+        if (length < UINT8_MAX) {
+            uint8_t runLength = (uint8_t)length;
+            [key appendBytes:&runLength length:1];
+        } else {
+            uint8_t longLength[9] = {UINT8_MAX};
+            for (NSUInteger i = 0; i < 8; i++) {
+                longLength[8 - i] = (uint8_t)((uint64_t)length >> (i * 8));
+            }
+            [key appendBytes:longLength length:sizeof(longLength)];
+        }
+        [key appendBytes:digits length:length];
+    }
+
+    return key;
+}
+
 @end
@@ -23,6 +23,7 @@
 #import "ImageNamedFinder.h"
 #import "NSArray+Respect.h"
 #import "NSString+Respect.h"
+#import "ResourceContentPrefetcher.h"
 
 // TODO: add a BundleFile subclass?
 // TODO: non main bundle
@@ -31,8 +32,34 @@
 // TODO: xml path hint?
 // TODO: image suggest smartness?
 
+// parsed xib content is an array of referenced resource names
+static ResourceContentParseBlock xibResourceNamesParseBlock = ^id(NSString *path, NSString **errorMessage) {
+    NSData *xibContent = [NSData dataWithContentsOfFile:path];
+    if (xibContent == nil) {
+        *errorMessage = @"Failed to read file";
+        return nil;
+    }
+
+    NSXMLDocument *dom = [[NSXMLDocument alloc]
+                          initWithData:xibContent options:0 error:NULL];
+    if (dom == nil) {
+        *errorMessage = @"Failed to parse file";
+        return nil;
+    }
+
+    NSMutableArray *resourceNames = [NSMutableArray array];
+    for (NSXMLNode *node in [dom.rootElement nodesForXPath:@"//string[@key='NSResourceName']"
+                                                     error:NULL]) {
+        [resourceNames addObject:node.stringValue];
+    }
+
+    return resourceNames;
+};
+
 @interface NibAction ()
 @property(nonatomic, strong, readwrite) ImageNamedFinder *imageNamedFinder;
+// xibs being read while matching continues, parsed by finishMatch
+@property(nonatomic, strong, readwrite) NSMutableOrderedSet *matchedXibPaths;
 @end
 
 @implementation NibAction
@@ -43,20 +70,15 @@
 
 
 - (void)parseResourceReferencesInXib:(NSString *)path {
-    NSData *xibContent = [NSData dataWithContentsOfFile:path];
-    if (xibContent == nil) {
+    NSString *errorMessage = nil;
+    NSArray *resourceNames = [self.linter.contentPrefetcher
+                              contentOfPath:path
+                              parseBlock:xibResourceNamesParseBlock
+                              errorMessage:&errorMessage];
+    if (resourceNames == nil) {
         [self.linter.lintErrors addObject:
          [LintError lintErrorWithFile:path
-                              message:@"Failed to read file"]];
-        return;
-    }
-    
-    NSXMLDocument *dom = [[NSXMLDocument alloc]
-                           initWithData:xibContent options:0 error:NULL];
-    if (dom == nil) {
-        [self.linter.lintErrors addObject:
-         [LintError lintErrorWithFile:path
-                              message:@"Failed to parse file"]];
+                              message:errorMessage]];
         return;
     }
     
@@ -69,30 +91,18 @@
         }
     }
     
-    for(NSXMLNode *node in [dom.rootElement nodesForXPath:@"//string[@key='NSResourceName']"
-                                                    error:NULL]) {
+    for (NSString *resourceName in resourceNames) {
         NSArray *resourcePaths = [self.imageNamedFinder
-                                  pathsForName:node.stringValue
+                                  pathsForName:resourceName
                                   usingFileExistsBlock:^BOOL(NSString *path) {
                                       return self.linter.bundleResources[path] != nil;
                                   }];
         
         for (NSString *resourcePath in resourcePaths) {
-            ResourceReference *resourceRef = [[ResourceReference alloc]
-                                               initWithResourcePath:resourcePath
-                                               referencePath:path
-                                               referenceLocation:MakeTextLineLocation(1)
-                                               missingResourceHint:
-                                               [self actionMissingResourceHint:resourcePath]];
-            [self.linter.resourceReferences addObject:resourceRef];
-            
-            BundleResource *bundleRes = self.linter.bundleResources[resourcePath];
-            if (bundleRes == nil) {
-                continue;
-            }
-            
-            [bundleRes.resourceReferences addObject:resourceRef];
-            [resourceRef.bundleResources addObject:bundleRes];
+            [self addReferenceToResourcePath:resourcePath
+                               referencePath:path
+                           referenceLocation:MakeTextLineLocation(1)
+                               referenceHint:nil];
         }
     }
 }
@@ -131,7 +141,21 @@
 }
 
 - (void)actionForMatchedBundleResource:(BundleResource *)bundleRes {
-    [self parseResourceReferencesInXib:bundleRes.buildSourcePath];
+    // only nibs found by matching are read, references are added when the
+    // matcher is done
+    if (self.matchedXibPaths == nil) {
+        self.matchedXibPaths = [NSMutableOrderedSet orderedSet];
+    }
+    [self.linter.contentPrefetcher prefetchContentOfPath:bundleRes.buildSourcePath
+                                              parseBlock:xibResourceNamesParseBlock];
+    [self.matchedXibPaths addObject:bundleRes.buildSourcePath];
+}
+
+- (void)finishMatch {
+    for (NSString *path in self.matchedXibPaths) {
+        [self parseResourceReferencesInXib:path];
+    }
+    self.matchedXibPaths = nil;
 }
 
 @end
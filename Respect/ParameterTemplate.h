@@ -0,0 +1,33 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * String with $<n> parameter references, like "$4.lproj/$3/$1.$2", parsed
+ * once into literal and parameter segments. Expanding appends the segments
+ * to a string of precomputed capacity without any regular expression.
+ * References to parameters that are not given are kept as is.
+ */
+
+@interface ParameterTemplate : NSObject
+@property(nonatomic, copy, readonly) NSString *templateString;
+@property(nonatomic, assign, readonly) BOOL hasParameters;
+
++ (instancetype)templateWithString:(NSString *)templateString;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithString:(NSString *)templateString NS_DESIGNATED_INITIALIZER;
+- (NSString *)stringByReplacingParameters:(NSArray *)parameters;
+@end
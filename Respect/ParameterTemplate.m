@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "ParameterTemplate.h"
+
+@interface ParameterTemplate () {
+    // parameter number for each segment, NSNotFound for literal segments
+    NSUInteger *_parameterNumbers;
+}
+@property(nonatomic, copy, readwrite) NSString *templateString;
+@property(nonatomic, assign, readwrite) BOOL hasParameters;
+// literal text for each segment, for parameter segments the reference
+// itself which is used if the parameter is not given
+@property(nonatomic, strong, readwrite) NSArray *segments;
+@end
+
+@implementation ParameterTemplate
+
++ (instancetype)templateWithString:(NSString *)templateString {
+    return [[self alloc] initWithString:templateString];
+}
+
+- (instancetype)initWithString:(NSString *)templateString {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.templateString = templateString;
+
+    NSMutableArray *segments = [NSMutableArray array];
+    NSUInteger length = templateString.length;
+    // at most one literal and one parameter segment per $
+    _parameterNumbers = malloc((length + 1) * sizeof(NSUInteger));
+    NSUInteger literalStart = 0;
+    NSUInteger i = 0;
+
+    while (i < length) {
+        if ([templateString characterAtIndex:i] != '$') {
+            i++;
+            continue;
+        }
+
+        NSUInteger digitsEnd = i + 1;
+        NSUInteger number = 0;
+        while (digitsEnd < length) {
+            unichar c = [templateString characterAtIndex:digitsEnd];
+            if (c < '0' || c > '9') {
+                break;
+            }
+            // large numbers will never be a given parameter
+            number = MIN(number * 10 + (c - '0'), (NSUInteger)INT_MAX);
+            digitsEnd++;
+        }
+        if (digitsEnd == i + 1) {
+            i++;
+            continue;
+        }
+
+        if (i > literalStart) {
+            _parameterNumbers[segments.count] = NSNotFound;
+            [segments addObject:[templateString substringWithRange:
+                                 NSMakeRange(literalStart, i - literalStart)]];
+        }
+        _parameterNumbers[segments.count] = number;
+        [segments addObject:[templateString substringWithRange:
+                             NSMakeRange(i, digitsEnd - i)]];
+        self.hasParameters = YES;
+
+        i = digitsEnd;
+        literalStart = i;
+    }
+
+    if (length > literalStart) {
+        _parameterNumbers[segments.count] = NSNotFound;
+        [segments addObject:[templateString substringFromIndex:literalStart]];
+    }
+
+    self.segments = segments;
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_parameterNumbers);
+}
+
+- (NSString *)stringByReplacingParameters:(NSArray *)parameters {
+    if (!self.hasParameters) {
+        return self.templateString;
+    }
+
+    NSArray *segments = self.segments;
+    NSUInteger segmentsCount = segments.count;
+    NSUInteger parametersCount = parameters.count;
+    NSUInteger length = 0;
+
+    for (NSUInteger i = 0; i < segmentsCount; i++) {
+        NSUInteger number = _parameterNumbers[i];
+        length += (number < parametersCount ?
+                   [parameters[number] length] :
+                   [segments[i] length]);
+    }
+
+    NSMutableString *replaced = [[NSMutableString alloc] initWithCapacity:length];
+    for (NSUInteger i = 0; i < segmentsCount; i++) {
+        NSUInteger number = _parameterNumbers[i];
+        [replaced appendString:(number < parametersCount ?
+                                parameters[number] :
+                                segments[i])];
+    }
+
+    return replaced;
+}
+
+@end
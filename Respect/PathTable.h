@@ -0,0 +1,38 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/*
+ * Interns path strings so that the same path is stored once no matter how
+ * many resources and references use it. Each distinct path gets a small
+ * integer id that is cheap to compare and hash. Owned by a linter so the
+ * paths are freed with it.
+ */
+
+#import <Foundation/Foundation.h>
+
+@interface PathTable : NSObject
+@property(nonatomic, assign, readonly) NSUInteger count;
+
+// NSNotFound for nil path
+- (NSUInteger)pathIDForPath:(NSString *)path;
+// nil for NSNotFound
+- (NSString *)pathForPathID:(NSUInteger)pathID;
+// shared instance equal to path
+- (NSString *)internedPath:(NSString *)path;
+// respect_sortKey computed once per path, nil for NSNotFound or non-ASCII
+- (NSData *)sortKeyForPathID:(NSUInteger)pathID;
+@end
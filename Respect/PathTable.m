@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "PathTable.h"
+#import "NSString+Respect.h"
+
+@interface PathTable ()
+// path is key, value is id
+@property(nonatomic, strong, readwrite) NSMutableDictionary *pathIDs;
+// index is id
+@property(nonatomic, strong, readwrite) NSMutableArray *paths;
+// index is id, NSNull if no key
+@property(nonatomic, strong, readwrite) NSMutableArray *sortKeys;
+@end
+
+@implementation PathTable
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.pathIDs = [NSMutableDictionary dictionary];
+    self.paths = [NSMutableArray array];
+    self.sortKeys = [NSMutableArray array];
+
+    return self;
+}
+
+- (NSUInteger)count {
+    @synchronized(self) {
+        return self.paths.count;
+    }
+}
+
+- (NSUInteger)pathIDForPath:(NSString *)path {
+    if (path == nil) {
+        return NSNotFound;
+    }
+
+    @synchronized(self) {
+        NSNumber *pathID = self.pathIDs[path];
+        if (pathID != nil) {
+            return pathID.unsignedIntegerValue;
+        }
+
+        // copy so that a mutable string can not change the key
+        path = [path copy];
+        NSUInteger newPathID = self.paths.count;
+        [self.paths addObject:path];
+        [self.sortKeys addObject:[path respect_sortKey] ?: [NSNull null]];
+        self.pathIDs[path] = @(newPathID);
+
+        return newPathID;
+    }
+}
+
+- (NSString *)pathForPathID:(NSUInteger)pathID {
+    if (pathID == NSNotFound) {
+        return nil;
+    }
+
+    @synchronized(self) {
+        return self.paths[pathID];
+    }
+}
+
+- (NSData *)sortKeyForPathID:(NSUInteger)pathID {
+    if (pathID == NSNotFound) {
+        return nil;
+    }
+
+    @synchronized(self) {
+        id sortKey = self.sortKeys[pathID];
+        return sortKey == [NSNull null] ? nil : sortKey;
+    }
+}
+
+- (NSString *)internedPath:(NSString *)path {
+    return [self pathForPathID:[self pathIDForPath:path]];
+}
+
+@end
@@ -14,10 +14,17 @@
 // KIND, either express or implied.  See the License for the
 // specific language governing permissions and limitations
 // under the License.
+/*
+ * Parameters for one match passed to actions. Parameters are kept as ranges
+ * into the matched text and are only turned into strings when an action asks
+ * for them. Matchers reuse one instance for all their matches so actions must
+ * not keep a reference after -performWithParameters: returns.
+ */
 
 #import "TextLocation.h"
 
 @interface PerformParameters : NSObject
+// array of NSString, created on first access for current match
 @property(nonatomic, strong, readonly) NSArray *parameters;
 @property(nonatomic, copy, readonly) NSString *path;
 @property(nonatomic, assign, readonly) TextLocation textLocation;
@@ -26,8 +33,17 @@
                                  path:(NSString *)path
                          textLocation:(TextLocation)textLocation;
 
-- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)init NS_DESIGNATED_INITIALIZER;
 - (instancetype)initWithParameters:(NSArray *)parameters
                     path:(NSString *)path
-            textLocation:(TextLocation)textLocation NS_DESIGNATED_INITIALIZER;
+            textLocation:(TextLocation)textLocation;
+
+// ranges with location NSNotFound becomes empty strings, unescape removes
+// backslash escapes from parameters
+- (void)resetWithText:(NSString *)text
+               ranges:(const NSRange *)ranges
+                count:(NSUInteger)count
+             unescape:(BOOL)unescape
+                 path:(NSString *)path
+         textLocation:(TextLocation)textLocation;
 @end
@@ -14,13 +14,19 @@
 // KIND, either express or implied.  See the License for the
 // specific language governing permissions and limitations
 // under the License.
-
 #import "PerformParameters.h"
+#import "NSString+Respect.h"
 
-@interface PerformParameters ()
+@interface PerformParameters () {
+    NSRange *_ranges;
+    NSUInteger _rangesCount;
+    NSUInteger _rangesCapacity;
+}
 @property(nonatomic, strong, readwrite) NSArray *parameters;
 @property(nonatomic, copy, readwrite) NSString *path;
 @property(nonatomic, assign, readwrite) TextLocation textLocation;
+@property(nonatomic, strong, readwrite) NSString *text;
+@property(nonatomic, assign, readwrite) BOOL unescape;
 @end
 
 @implementation PerformParameters
@@ -33,10 +39,21 @@
                                 textLocation:textLocation];
 }
 
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.parameters = @[];
+
+    return self;
+}
+
 - (instancetype)initWithParameters:(NSArray *)parameters
                     path:(NSString *)path
             textLocation:(TextLocation)textLocation {
-    self = [super init];
+    self = [self init];
     if (self == nil) {
         return nil;
     }
@@ -48,5 +65,58 @@
     return self;
 }
 
+- (void)dealloc {
+    free(_ranges);
+}
+
+- (void)resetWithText:(NSString *)text
+               ranges:(const NSRange *)ranges
+                count:(NSUInteger)count
+             unescape:(BOOL)unescape
+                 path:(NSString *)path
+         textLocation:(TextLocation)textLocation {
+    if (count > _rangesCapacity) {
+        _rangesCapacity = MAX(count, _rangesCapacity * 2);
+        _ranges = realloc(_ranges, _rangesCapacity * sizeof(NSRange));
+    }
+    if (count > 0) {
+        memcpy(_ranges, ranges, count * sizeof(NSRange));
+    }
+    _rangesCount = count;
+
+    self.text = text;
+    self.unescape = unescape;
+    self.path = path;
+    self.textLocation = textLocation;
+    self.parameters = nil;
+}
+
+- (NSArray *)parameters {
+    if (_parameters != nil) {
+        return _parameters;
+    }
+
+    NSMutableArray *parameters = [NSMutableArray arrayWithCapacity:_rangesCount];
+    for (NSUInteger i = 0; i < _rangesCount; i++) {
+        NSRange range = _ranges[i];
+        if (range.location == NSNotFound) {
+            [parameters addObject:@""];
+            continue;
+        }
+
+        NSString *parameter = [self.text substringWithRange:range];
+        // only unescape if there is something to unescape
+        if (self.unescape &&
+            [self.text rangeOfString:@"\\"
+                             options:NSLiteralSearch
+                               range:range].location != NSNotFound) {
+            parameter = [parameter respect_stringByUnEscaping];
+        }
+        [parameters addObject:parameter];
+    }
+    _parameters = parameters;
+
+    return _parameters;
+}
 
 @end
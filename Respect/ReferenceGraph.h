@@ -0,0 +1,58 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/*
+ * Distinct resource references as an edge list between interned path ids
+ * and a source location. Adding an edge that already exists returns the
+ * existing reference, so memory grows with distinct references and not with
+ * the number of matches.
+ */
+
+#import "ResourceReference.h"
+#import "TextLocation.h"
+#import "PathTable.h"
+
+typedef struct _ReferenceEdge {
+    NSUInteger resourcePathID;
+    NSUInteger referencePathID;
+    NSUInteger lineNumber;
+    NSUInteger column;
+    // id among hints of this graph, NSNotFound if no hint
+    NSUInteger referenceHintID;
+} ReferenceEdge;
+
+@interface ReferenceGraph : NSObject
+// interns paths of references
+@property(nonatomic, strong, readonly) PathTable *pathTable;
+@property(nonatomic, assign, readonly) NSUInteger count;
+@property(nonatomic, assign, readonly) const ReferenceEdge *edges;
+// ResourceReference for each edge, same order as edges
+@property(nonatomic, strong, readonly) NSArray *references;
+
+// with a new path table
+- (instancetype)init;
+- (instancetype)initWithPathTable:(PathTable *)pathTable NS_DESIGNATED_INITIALIZER;
+
+// returns existing reference if same edge has already been added, isNew is
+// set to indicate which, missingResourceHint is only called for new edges
+- (ResourceReference *)addReferenceToResourcePath:(NSString *)resourcePath
+                                    referencePath:(NSString *)referencePath
+                                referenceLocation:(TextLocation)referenceLocation
+                                    referenceHint:(NSString *)referenceHint
+                              missingResourceHint:(NSString *(^)(void))missingResourceHint
+                                            isNew:(BOOL *)isNew;
+@end
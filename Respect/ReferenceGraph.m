@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ReferenceGraph.h"
+
+// open addressing hash table of edge index + 1, 0 is empty bucket
+static const NSUInteger ReferenceGraphInitialCapacity = 64;
+
+@interface ReferenceGraph ()
+@property(nonatomic, strong, readwrite) PathTable *pathTable;
+@property(nonatomic, assign, readwrite) NSUInteger count;
+@property(nonatomic, strong, readwrite) NSMutableArray *mutableReferences;
+// hint is key, value is id. hints are not paths so not in path table
+@property(nonatomic, strong, readwrite) NSMutableDictionary *hintIDs;
+@end
+
+@implementation ReferenceGraph {
+    ReferenceEdge *_edges;
+    NSUInteger _edgesCapacity;
+    NSUInteger *_buckets;
+    NSUInteger _bucketsCapacity;
+}
+
+static NSUInteger edgeHash(const ReferenceEdge *edge) {
+    NSUInteger h = edge->resourcePathID;
+    h = h * 31 + edge->referencePathID;
+    h = h * 31 + edge->lineNumber;
+    h = h * 31 + edge->column;
+    h = h * 31 + edge->referenceHintID;
+    // spread low bits as capacity is a power of two
+    h ^= h >> 16;
+    return h * 0x45d9f3b;
+}
+
+static BOOL edgeEqual(const ReferenceEdge *a, const ReferenceEdge *b) {
+    return (a->resourcePathID == b->resourcePathID &&
+            a->referencePathID == b->referencePathID &&
+            a->lineNumber == b->lineNumber &&
+            a->column == b->column &&
+            a->referenceHintID == b->referenceHintID);
+}
+
+- (instancetype)init {
+    return [self initWithPathTable:[[PathTable alloc] init]];
+}
+
+- (instancetype)initWithPathTable:(PathTable *)pathTable {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.pathTable = pathTable;
+    self.mutableReferences = [NSMutableArray array];
+    self.hintIDs = [NSMutableDictionary dictionary];
+    _edgesCapacity = ReferenceGraphInitialCapacity;
+    _edges = malloc(sizeof(ReferenceEdge) * _edgesCapacity);
+    _bucketsCapacity = ReferenceGraphInitialCapacity * 2;
+    _buckets = calloc(_bucketsCapacity, sizeof(NSUInteger));
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_edges);
+    free(_buckets);
+}
+
+- (const ReferenceEdge *)edges {
+    return _edges;
+}
+
+- (NSArray *)references {
+    return self.mutableReferences;
+}
+
+// bucket index of edge or of the empty bucket where it should be inserted
+- (NSUInteger)bucketIndexForEdge:(const ReferenceEdge *)edge {
+    NSUInteger mask = _bucketsCapacity - 1;
+    NSUInteger i = edgeHash(edge) & mask;
+
+    for (;;) {
+        NSUInteger bucket = _buckets[i];
+        if (bucket == 0 || edgeEqual(&_edges[bucket - 1], edge)) {
+            return i;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+- (void)growBuckets {
+    free(_buckets);
+    _bucketsCapacity *= 2;
+    _buckets = calloc(_bucketsCapacity, sizeof(NSUInteger));
+
+    for (NSUInteger i = 0; i < self.count; i++) {
+        _buckets[[self bucketIndexForEdge:&_edges[i]]] = i + 1;
+    }
+}
+
+- (NSUInteger)hintIDForHint:(NSString *)hint {
+    if (hint == nil) {
+        return NSNotFound;
+    }
+
+    NSNumber *hintID = self.hintIDs[hint];
+    if (hintID == nil) {
+        hintID = @(self.hintIDs.count);
+        self.hintIDs[[hint copy]] = hintID;
+    }
+
+    return hintID.unsignedIntegerValue;
+}
+
+- (ResourceReference *)addReferenceToResourcePath:(NSString *)resourcePath
+                                    referencePath:(NSString *)referencePath
+                                referenceLocation:(TextLocation)referenceLocation
+                                    referenceHint:(NSString *)referenceHint
+                              missingResourceHint:(NSString *(^)(void))missingResourceHint
+                                            isNew:(BOOL *)isNew {
+    PathTable *pathTable = self.pathTable;
+    ReferenceEdge edge = {
+        .resourcePathID = [pathTable pathIDForPath:resourcePath],
+        .referencePathID = [pathTable pathIDForPath:referencePath],
+        .lineNumber = referenceLocation.lineNumber,
+        .column = referenceLocation.inLineRange.location,
+        .referenceHintID = [self hintIDForHint:referenceHint]
+    };
+
+    NSUInteger bucketIndex = [self bucketIndexForEdge:&edge];
+    if (_buckets[bucketIndex] != 0) {
+        if (isNew != NULL) {
+            *isNew = NO;
+        }
+        return self.mutableReferences[_buckets[bucketIndex] - 1];
+    }
+
+    if (self.count == _edgesCapacity) {
+        _edgesCapacity *= 2;
+        _edges = realloc(_edges, sizeof(ReferenceEdge) * _edgesCapacity);
+    }
+    _edges[self.count] = edge;
+
+    ResourceReference *resourceRef = [[ResourceReference alloc]
+                                      initWithResourcePath:resourcePath
+                                      referencePath:referencePath
+                                      referenceLocation:referenceLocation
+                                      referenceHint:referenceHint
+                                      missingResourceHint:
+                                      missingResourceHint != nil ? missingResourceHint() : nil
+                                      pathTable:pathTable];
+    [self.mutableReferences addObject:resourceRef];
+
+    _buckets[bucketIndex] = self.count + 1;
+    self.count++;
+    // keep load factor below 1/2
+    if (self.count * 2 > _bucketsCapacity) {
+        [self growBuckets];
+    }
+
+    if (isNew != NULL) {
+        *isNew = YES;
+    }
+
+    return resourceRef;
+}
+
+@end
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Resource references of earlier lint runs persisted as a flat file that is
+ * memory mapped when queried, so "who uses this image?" can be answered
+ * without parsing the project again.
+ *
+ * Layout is a header followed by a sorted string table, bundle resources
+ * sorted by path, edges sorted by resource and edge indexes sorted by
+ * referencing file. All numbers are 32 bit in host byte order.
+ *
+ * Each lint run (project, target and configuration) is replaced as a whole
+ * when written again and runs not linted are kept.
+ */
+
+#import "ResourceLinter.h"
+
+extern NSString * const ReferenceIndexErrorDomain;
+
+@interface ReferenceIndexEntry : NSObject
+// bundle path
+@property(nonatomic, copy, readonly) NSString *resourcePath;
+// relative to source root if inside it
+@property(nonatomic, copy, readonly) NSString *referencePath;
+@property(nonatomic, assign, readonly) NSUInteger lineNumber;
+// "Project Target Configuration" of lint run
+@property(nonatomic, copy, readonly) NSString *runName;
+// no bundle resource with resource path
+@property(nonatomic, assign, readonly) BOOL isMissing;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithResourcePath:(NSString *)resourcePath
+                       referencePath:(NSString *)referencePath
+                          lineNumber:(NSUInteger)lineNumber
+                             runName:(NSString *)runName
+                           isMissing:(BOOL)isMissing NS_DESIGNATED_INITIALIZER;
+@end
+
+@interface ReferenceIndex : NSObject
+@property(nonatomic, assign, readonly) NSUInteger runCount;
+
++ (instancetype)indexWithContentsOfFile:(NSString *)path error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithData:(NSData *)data error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+// paths match if equal or if path is a suffix after a "/", so "a.png" matches
+// "images/a.png". ReferenceIndexEntry sorted by resource path, reference path
+// and line number
+- (NSArray *)referencesToPath:(NSString *)path;
+// same but sorted by reference path, line number and resource path
+- (NSArray *)referencesByPath:(NSString *)path;
+// bundle paths matching path, sorted
+- (NSArray *)bundleResourcesMatchingPath:(NSString *)path;
+@end
+
+@interface ReferenceIndexWriter : NSObject
+- (instancetype)init NS_DESIGNATED_INITIALIZER;
+// add references and bundle resources of a lint run
+- (void)addLinter:(ResourceLinter *)linter;
+- (void)addEntry:(ReferenceIndexEntry *)entry;
+- (void)addBundleResourcePath:(NSString *)path runName:(NSString *)runName;
+// index of what has been added
+- (NSData *)indexData;
+// merge with runs in existing index at path not added and write atomically
+- (BOOL)updateIndexAtPath:(NSString *)path error:(NSError **)error;
+@end
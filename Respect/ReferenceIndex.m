@@ -0,0 +1,576 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ReferenceIndex.h"
+#import "ResourceReference.h"
+#import "NSString+Respect.h"
+
+NSString * const ReferenceIndexErrorDomain = @"ReferenceIndexErrorDomain";
+
+static const char kReferenceIndexMagic[8] = "RSPINDX";
+static const uint32_t kReferenceIndexVersion = 1;
+static const uint32_t kReferenceIndexEdgeMissing = 1 << 0;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t stringCount;
+    uint32_t runCount;
+    uint32_t resourceCount;
+    uint32_t edgeCount;
+    // stringCount + 1 offsets into strings, last is end of strings
+    uint32_t stringOffsetsOffset;
+    uint32_t stringsOffset;
+    // string ids of run names
+    uint32_t runsOffset;
+    uint32_t resourcesOffset;
+    uint32_t edgesOffset;
+    // edge indexes
+    uint32_t edgesByReferenceOffset;
+} ReferenceIndexHeader;
+
+typedef struct {
+    uint32_t path;
+    uint32_t run;
+} ReferenceIndexResource;
+
+typedef struct {
+    uint32_t resource;
+    uint32_t reference;
+    uint32_t line;
+    uint32_t run;
+    uint32_t flags;
+} ReferenceIndexEdge;
+
+static NSError *makeReferenceIndexError(NSString *format, ...) {
+    va_list ap;
+    va_start(ap, format);
+    NSString *description = [[NSString alloc]
+                             initWithFormat:format arguments:ap];
+    va_end(ap);
+
+    return [NSError errorWithDomain:ReferenceIndexErrorDomain
+                               code:0
+                           userInfo:@{NSLocalizedDescriptionKey: description}];
+}
+
+// string ids are in sorted string order so comparing ids compares strings
+static int compare_resources(const void *a, const void *b) {
+    const ReferenceIndexResource *ra = a;
+    const ReferenceIndexResource *rb = b;
+    if (ra->path != rb->path) {
+        return ra->path < rb->path ? -1 : 1;
+    }
+    if (ra->run != rb->run) {
+        return ra->run < rb->run ? -1 : 1;
+    }
+    return 0;
+}
+
+static int compare_edges_by_resource(const void *a, const void *b) {
+    const ReferenceIndexEdge *ea = a;
+    const ReferenceIndexEdge *eb = b;
+    const uint32_t fa[] = {ea->resource, ea->reference, ea->line, ea->run};
+    const uint32_t fb[] = {eb->resource, eb->reference, eb->line, eb->run};
+    for (size_t i = 0; i < sizeof(fa) / sizeof(fa[0]); i++) {
+        if (fa[i] != fb[i]) {
+            return fa[i] < fb[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+typedef struct {
+    ReferenceIndexEdge edge;
+    uint32_t index;
+} ReferenceIndexEdgeIndex;
+
+static int compare_edges_by_reference(const void *a, const void *b) {
+    const ReferenceIndexEdge *ea = &((const ReferenceIndexEdgeIndex *)a)->edge;
+    const ReferenceIndexEdge *eb = &((const ReferenceIndexEdgeIndex *)b)->edge;
+    const uint32_t fa[] = {ea->reference, ea->line, ea->resource, ea->run};
+    const uint32_t fb[] = {eb->reference, eb->line, eb->resource, eb->run};
+    for (size_t i = 0; i < sizeof(fa) / sizeof(fa[0]); i++) {
+        if (fa[i] != fb[i]) {
+            return fa[i] < fb[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// equal or suffix after a "/"
+static BOOL path_matches(const char *s, size_t slength, const char *q, size_t qlength) {
+    if (slength == qlength) {
+        return memcmp(s, q, qlength) == 0;
+    }
+
+    return (slength > qlength &&
+            s[slength - qlength - 1] == '/' &&
+            memcmp(s + slength - qlength, q, qlength) == 0);
+}
+
+static BOOL section_fits(uint32_t offset, uint64_t count, size_t size, NSUInteger length) {
+    return (offset % sizeof(uint32_t) == 0 &&
+            (uint64_t)offset + count * size <= length);
+}
+
+
+@implementation ReferenceIndexEntry
+
+- (instancetype)initWithResourcePath:(NSString *)resourcePath
+                       referencePath:(NSString *)referencePath
+                          lineNumber:(NSUInteger)lineNumber
+                             runName:(NSString *)runName
+                           isMissing:(BOOL)isMissing {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    _resourcePath = [resourcePath copy];
+    _referencePath = [referencePath copy];
+    _lineNumber = lineNumber;
+    _runName = [runName copy];
+    _isMissing = isMissing;
+
+    return self;
+}
+
+@end
+
+
+@interface ReferenceIndex ()
+@property(nonatomic, assign, readwrite) NSUInteger runCount;
+@property(nonatomic, strong, readwrite) NSData *data;
+
+// all entries and @[bundle path, run name] for rewriting index
+- (NSArray *)allEntries;
+- (NSArray *)allBundleResources;
+- (NSString *)runNameAtIndex:(NSUInteger)index;
+@end
+
+@implementation ReferenceIndex {
+    const ReferenceIndexHeader *_header;
+    const uint32_t *_stringOffsets;
+    const char *_strings;
+    const uint32_t *_runs;
+    const ReferenceIndexResource *_resources;
+    const ReferenceIndexEdge *_edges;
+    const uint32_t *_edgesByReference;
+}
+
++ (instancetype)indexWithContentsOfFile:(NSString *)path error:(NSError **)error {
+    // mapped so only the pages touched by a query are read
+    NSData *data = [NSData dataWithContentsOfFile:path
+                                          options:NSDataReadingMappedIfSafe
+                                            error:error];
+    if (data == nil) {
+        return nil;
+    }
+
+    return [[self alloc] initWithData:data error:error];
+}
+
+- (instancetype)initWithData:(NSData *)data error:(NSError **)error {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.data = data;
+    const char *bytes = data.bytes;
+    NSUInteger length = data.length;
+    _header = (const ReferenceIndexHeader *)bytes;
+
+    if (length < sizeof(ReferenceIndexHeader) ||
+        memcmp(_header->magic, kReferenceIndexMagic, sizeof(kReferenceIndexMagic)) != 0 ||
+        _header->version != kReferenceIndexVersion ||
+        !section_fits(_header->stringOffsetsOffset, (uint64_t)_header->stringCount + 1,
+                      sizeof(uint32_t), length) ||
+        !section_fits(_header->runsOffset, _header->runCount, sizeof(uint32_t), length) ||
+        !section_fits(_header->resourcesOffset, _header->resourceCount,
+                      sizeof(ReferenceIndexResource), length) ||
+        !section_fits(_header->edgesOffset, _header->edgeCount,
+                      sizeof(ReferenceIndexEdge), length) ||
+        !section_fits(_header->edgesByReferenceOffset, _header->edgeCount,
+                      sizeof(uint32_t), length)) {
+        if (error != NULL) {
+            *error = makeReferenceIndexError(@"Not a reference index or unsupported version");
+        }
+        return nil;
+    }
+
+    _stringOffsets = (const uint32_t *)(bytes + _header->stringOffsetsOffset);
+    _strings = bytes + _header->stringsOffset;
+    _runs = (const uint32_t *)(bytes + _header->runsOffset);
+    _resources = (const ReferenceIndexResource *)(bytes + _header->resourcesOffset);
+    _edges = (const ReferenceIndexEdge *)(bytes + _header->edgesOffset);
+    _edgesByReference = (const uint32_t *)(bytes + _header->edgesByReferenceOffset);
+
+    // check all ids once so lookups can trust them
+    uint32_t stringCount = _header->stringCount;
+    BOOL valid = ((uint64_t)_header->stringsOffset + _stringOffsets[stringCount] <= length);
+    for (uint32_t i = 0; valid && i < stringCount; i++) {
+        valid = _stringOffsets[i] <= _stringOffsets[i + 1];
+    }
+    for (uint32_t i = 0; valid && i < _header->runCount; i++) {
+        valid = _runs[i] < stringCount;
+    }
+    for (uint32_t i = 0; valid && i < _header->resourceCount; i++) {
+        valid = _resources[i].path < stringCount && _resources[i].run < stringCount;
+    }
+    for (uint32_t i = 0; valid && i < _header->edgeCount; i++) {
+        valid = (_edges[i].resource < stringCount &&
+                 _edges[i].reference < stringCount &&
+                 _edges[i].run < stringCount &&
+                 _edgesByReference[i] < _header->edgeCount);
+    }
+    if (!valid) {
+        if (error != NULL) {
+            *error = makeReferenceIndexError(@"Reference index is corrupt");
+        }
+        return nil;
+    }
+
+    self.runCount = _header->runCount;
+
+    return self;
+}
+
+- (NSString *)stringForID:(uint32_t)stringID {
+    return [[NSString alloc] initWithBytes:_strings + _stringOffsets[stringID]
+                                    length:_stringOffsets[stringID + 1] - _stringOffsets[stringID]
+                                  encoding:NSUTF8StringEncoding];
+}
+
+- (ReferenceIndexEntry *)entryForEdge:(const ReferenceIndexEdge *)edge {
+    return [[ReferenceIndexEntry alloc]
+            initWithResourcePath:[self stringForID:edge->resource]
+            referencePath:[self stringForID:edge->reference]
+            lineNumber:edge->line
+            runName:[self stringForID:edge->run]
+            isMissing:(edge->flags & kReferenceIndexEdgeMissing) != 0];
+}
+
+// calloc:ed array with YES for each string id matching path
+- (BOOL *)copyMatchingStringIDs:(NSString *)path {
+    BOOL *matching = calloc(MAX(_header->stringCount, 1), sizeof(BOOL));
+    const char *q = path.UTF8String;
+    size_t qlength = q != NULL ? strlen(q) : 0;
+    if (qlength == 0) {
+        return matching;
+    }
+
+    for (uint32_t i = 0; i < _header->stringCount; i++) {
+        matching[i] = path_matches(_strings + _stringOffsets[i],
+                                   _stringOffsets[i + 1] - _stringOffsets[i],
+                                   q, qlength);
+    }
+
+    return matching;
+}
+
+- (NSArray *)referencesToPath:(NSString *)path {
+    NSMutableArray *entries = [NSMutableArray array];
+    BOOL *matching = [self copyMatchingStringIDs:path];
+    uint32_t edgeCount = _header->edgeCount;
+
+    for (uint32_t stringID = 0; stringID < _header->stringCount; stringID++) {
+        if (!matching[stringID]) {
+            continue;
+        }
+
+        // first edge with resource, edges are sorted by resource
+        uint32_t low = 0;
+        uint32_t high = edgeCount;
+        while (low < high) {
+            uint32_t mid = low + (high - low) / 2;
+            if (_edges[mid].resource < stringID) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        for (uint32_t i = low; i < edgeCount && _edges[i].resource == stringID; i++) {
+            [entries addObject:[self entryForEdge:&_edges[i]]];
+        }
+    }
+    free(matching);
+
+    return entries;
+}
+
+- (NSArray *)referencesByPath:(NSString *)path {
+    NSMutableArray *entries = [NSMutableArray array];
+    BOOL *matching = [self copyMatchingStringIDs:path];
+    uint32_t edgeCount = _header->edgeCount;
+
+    for (uint32_t stringID = 0; stringID < _header->stringCount; stringID++) {
+        if (!matching[stringID]) {
+            continue;
+        }
+
+        uint32_t low = 0;
+        uint32_t high = edgeCount;
+        while (low < high) {
+            uint32_t mid = low + (high - low) / 2;
+            if (_edges[_edgesByReference[mid]].reference < stringID) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        for (uint32_t i = low;
+             i < edgeCount && _edges[_edgesByReference[i]].reference == stringID;
+             i++) {
+            [entries addObject:[self entryForEdge:&_edges[_edgesByReference[i]]]];
+        }
+    }
+    free(matching);
+
+    return entries;
+}
+
+- (NSArray *)bundleResourcesMatchingPath:(NSString *)path {
+    NSMutableArray *paths = [NSMutableArray array];
+    BOOL *matching = [self copyMatchingStringIDs:path];
+    uint32_t previousPath = UINT32_MAX;
+
+    for (uint32_t i = 0; i < _header->resourceCount; i++) {
+        uint32_t pathID = _resources[i].path;
+        if (matching[pathID] && pathID != previousPath) {
+            [paths addObject:[self stringForID:pathID]];
+            previousPath = pathID;
+        }
+    }
+    free(matching);
+
+    return paths;
+}
+
+- (NSArray *)allEntries {
+    NSMutableArray *entries = [NSMutableArray arrayWithCapacity:_header->edgeCount];
+    for (uint32_t i = 0; i < _header->edgeCount; i++) {
+        [entries addObject:[self entryForEdge:&_edges[i]]];
+    }
+
+    return entries;
+}
+
+- (NSArray *)allBundleResources {
+    NSMutableArray *resources = [NSMutableArray arrayWithCapacity:_header->resourceCount];
+    for (uint32_t i = 0; i < _header->resourceCount; i++) {
+        [resources addObject:@[[self stringForID:_resources[i].path],
+                               [self stringForID:_resources[i].run]]];
+    }
+
+    return resources;
+}
+
+- (NSString *)runNameAtIndex:(NSUInteger)index {
+    return [self stringForID:_runs[index]];
+}
+
+@end
+
+
+@interface ReferenceIndexWriter ()
+@property(nonatomic, strong, readwrite) NSMutableArray *entries;
+// @[bundle path, run name]
+@property(nonatomic, strong, readwrite) NSMutableArray *bundleResources;
+@property(nonatomic, strong, readwrite) NSMutableOrderedSet *runNames;
+@end
+
+@implementation ReferenceIndexWriter
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.entries = [NSMutableArray array];
+    self.bundleResources = [NSMutableArray array];
+    self.runNames = [NSMutableOrderedSet orderedSet];
+
+    return self;
+}
+
+- (void)addLinter:(ResourceLinter *)linter {
+    id<ResourceLinterSource> linterSource = linter.linterSource;
+    NSString *sourceRoot = [linterSource sourceRoot];
+    NSString *runName = [NSString stringWithFormat:@"%@ %@ %@",
+                         [linterSource projectName],
+                         [linterSource targetName],
+                         [linterSource configurationName]];
+    [self.runNames addObject:runName];
+
+    for (ResourceReference *resourceRef in linter.referenceGraph.references) {
+        [self addEntry:
+         [[ReferenceIndexEntry alloc]
+          initWithResourcePath:resourceRef.resourcePath
+          referencePath:([resourceRef.referencePath
+                          respect_stringRelativeToPathPrefix:sourceRoot] ?: @"")
+          lineNumber:resourceRef.referenceLocation.lineNumber
+          runName:runName
+          isMissing:resourceRef.bundleResources.count == 0]];
+    }
+
+    for (NSString *bundlePath in linter.bundleResources) {
+        [self addBundleResourcePath:bundlePath runName:runName];
+    }
+}
+
+- (void)addEntry:(ReferenceIndexEntry *)entry {
+    [self.runNames addObject:entry.runName];
+    [self.entries addObject:entry];
+}
+
+- (void)addBundleResourcePath:(NSString *)path runName:(NSString *)runName {
+    [self.runNames addObject:runName];
+    [self.bundleResources addObject:@[path, runName]];
+}
+
+- (NSData *)indexData {
+    NSMutableSet *stringSet = [NSMutableSet setWithArray:self.runNames.array];
+    for (ReferenceIndexEntry *entry in self.entries) {
+        [stringSet addObject:entry.resourcePath ?: @""];
+        [stringSet addObject:entry.referencePath ?: @""];
+        [stringSet addObject:entry.runName];
+    }
+    for (NSArray *bundleResource in self.bundleResources) {
+        [stringSet addObject:bundleResource[0]];
+        [stringSet addObject:bundleResource[1]];
+    }
+
+    NSArray *strings = [stringSet.allObjects sortedArrayUsingSelector:@selector(compare:)];
+    NSMutableDictionary *stringIDs = [NSMutableDictionary dictionaryWithCapacity:strings.count];
+    NSMutableData *stringBytes = [NSMutableData data];
+    NSMutableData *stringOffsets = [NSMutableData data];
+    for (NSString *string in strings) {
+        stringIDs[string] = @(stringIDs.count);
+        uint32_t offset = (uint32_t)stringBytes.length;
+        [stringOffsets appendBytes:&offset length:sizeof(offset)];
+        [stringBytes appendData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+    uint32_t stringsEnd = (uint32_t)stringBytes.length;
+    [stringOffsets appendBytes:&stringsEnd length:sizeof(stringsEnd)];
+    // keep following sections aligned
+    stringBytes.length = (stringBytes.length + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+
+    NSMutableData *runs = [NSMutableData data];
+    for (NSString *runName in self.runNames) {
+        uint32_t runID = [stringIDs[runName] unsignedIntValue];
+        [runs appendBytes:&runID length:sizeof(runID)];
+    }
+
+    size_t resourceCount = self.bundleResources.count;
+    ReferenceIndexResource *resources = calloc(MAX(resourceCount, 1),
+                                               sizeof(ReferenceIndexResource));
+    for (size_t i = 0; i < resourceCount; i++) {
+        resources[i].path = [stringIDs[self.bundleResources[i][0]] unsignedIntValue];
+        resources[i].run = [stringIDs[self.bundleResources[i][1]] unsignedIntValue];
+    }
+    qsort(resources, resourceCount, sizeof(ReferenceIndexResource), compare_resources);
+
+    size_t edgeCount = self.entries.count;
+    ReferenceIndexEdge *edges = calloc(MAX(edgeCount, 1), sizeof(ReferenceIndexEdge));
+    for (size_t i = 0; i < edgeCount; i++) {
+        ReferenceIndexEntry *entry = self.entries[i];
+        edges[i] = (ReferenceIndexEdge){
+            .resource = [stringIDs[entry.resourcePath ?: @""] unsignedIntValue],
+            .reference = [stringIDs[entry.referencePath ?: @""] unsignedIntValue],
+            .line = (uint32_t)entry.lineNumber,
+            .run = [stringIDs[entry.runName] unsignedIntValue],
+            .flags = entry.isMissing ? kReferenceIndexEdgeMissing : 0};
+    }
+    qsort(edges, edgeCount, sizeof(ReferenceIndexEdge), compare_edges_by_resource);
+
+    // references on the same line only differing in column are one edge
+    size_t uniqueCount = 0;
+    for (size_t i = 0; i < edgeCount; i++) {
+        if (uniqueCount > 0 && compare_edges_by_resource(&edges[uniqueCount - 1], &edges[i]) == 0) {
+            continue;
+        }
+        edges[uniqueCount++] = edges[i];
+    }
+    edgeCount = uniqueCount;
+
+    ReferenceIndexEdgeIndex *edgeIndexes = calloc(MAX(edgeCount, 1),
+                                                  sizeof(ReferenceIndexEdgeIndex));
+    for (size_t i = 0; i < edgeCount; i++) {
+        edgeIndexes[i] = (ReferenceIndexEdgeIndex){.edge = edges[i], .index = (uint32_t)i};
+    }
+    qsort(edgeIndexes, edgeCount, sizeof(ReferenceIndexEdgeIndex), compare_edges_by_reference);
+
+    ReferenceIndexHeader header = {
+        .version = kReferenceIndexVersion,
+        .stringCount = (uint32_t)strings.count,
+        .runCount = (uint32_t)self.runNames.count,
+        .resourceCount = (uint32_t)resourceCount,
+        .edgeCount = (uint32_t)edgeCount
+    };
+    memcpy(header.magic, kReferenceIndexMagic, sizeof(header.magic));
+    header.stringOffsetsOffset = sizeof(ReferenceIndexHeader);
+    header.stringsOffset = header.stringOffsetsOffset + (uint32_t)stringOffsets.length;
+    header.runsOffset = header.stringsOffset + (uint32_t)stringBytes.length;
+    header.resourcesOffset = header.runsOffset + (uint32_t)runs.length;
+    header.edgesOffset = (header.resourcesOffset +
+                          (uint32_t)(resourceCount * sizeof(ReferenceIndexResource)));
+    header.edgesByReferenceOffset = (header.edgesOffset +
+                                     (uint32_t)(edgeCount * sizeof(ReferenceIndexEdge)));
+
+    NSMutableData *data = [NSMutableData dataWithBytes:&header length:sizeof(header)];
+    [data appendData:stringOffsets];
+    [data appendData:stringBytes];
+    [data appendData:runs];
+    [data appendBytes:resources length:resourceCount * sizeof(ReferenceIndexResource)];
+    [data appendBytes:edges length:edgeCount * sizeof(ReferenceIndexEdge)];
+    for (size_t i = 0; i < edgeCount; i++) {
+        [data appendBytes:&edgeIndexes[i].index length:sizeof(uint32_t)];
+    }
+
+    free(resources);
+    free(edges);
+    free(edgeIndexes);
+
+    return data;
+}
+
+- (BOOL)updateIndexAtPath:(NSString *)path error:(NSError **)error {
+    // keep runs not linted this time, an unreadable old index is replaced
+    ReferenceIndex *index = [ReferenceIndex indexWithContentsOfFile:path error:NULL];
+    if (index != nil) {
+        for (ReferenceIndexEntry *entry in [index allEntries]) {
+            if (![self.runNames containsObject:entry.runName]) {
+                [self.entries addObject:entry];
+            }
+        }
+        for (NSArray *bundleResource in [index allBundleResources]) {
+            if (![self.runNames containsObject:bundleResource[1]]) {
+                [self.bundleResources addObject:bundleResource];
+            }
+        }
+        for (NSUInteger i = 0; i < index.runCount; i++) {
+            [self.runNames addObject:[index runNameAtIndex:i]];
+        }
+    }
+
+    return [[self indexData] writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
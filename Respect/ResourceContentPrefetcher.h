@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Reads and parses resource files on a background queue so that actions
+ * consuming file content, like nibs and plists, do not stall matching on
+ * disk I/O. Results are keyed by path and parse block, so the same path parsed
+ * differently by two consumers is kept apart, and forgotten once returned. A
+ * path not prefetched or already returned is parsed synchronously on request.
+ */
+
+#import <Foundation/Foundation.h>
+
+// called on a background queue, must only touch its own objects. return nil
+// and set errorMessage on failure
+typedef id (^ResourceContentParseBlock)(NSString *path, NSString **errorMessage);
+
+@interface ResourceContentPrefetcher : NSObject
+// schedule parse of path, does nothing if already scheduled with same parse
+// block. parse blocks should be long lived, like a static block, as they are
+// compared by identity
+- (void)prefetchContentOfPath:(NSString *)path
+                   parseBlock:(ResourceContentParseBlock)parseBlock;
+// waits for prefetch if in progress, only prefetch content that is requested
+- (id)contentOfPath:(NSString *)path
+         parseBlock:(ResourceContentParseBlock)parseBlock
+       errorMessage:(NSString **)errorMessage;
+@end
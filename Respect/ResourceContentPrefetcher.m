@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "ResourceContentPrefetcher.h"
+
+// max number of files read at the same time
+static const NSInteger kMaxConcurrentReads = 4;
+
+@interface ResourceContentPrefetchEntry : NSObject
+// weak as the operation captures the entry, nil once finished and released
+@property(nonatomic, weak, readwrite) NSOperation *operation;
+@property(nonatomic, strong, readwrite) id content;
+@property(nonatomic, copy, readwrite) NSString *errorMessage;
+@end
+
+@implementation ResourceContentPrefetchEntry
+@end
+
+@interface ResourceContentPrefetcher ()
+@property(nonatomic, strong, readwrite) NSOperationQueue *queue;
+// parse block -> path -> ResourceContentPrefetchEntry until content is
+// returned, so consumers of the same path with different parsers get their own
+// content. only accessed from calling thread
+@property(nonatomic, strong, readwrite) NSMapTable *entries;
+
+- (NSMutableDictionary *)entriesForParseBlock:(ResourceContentParseBlock)parseBlock;
+@end
+
+@implementation ResourceContentPrefetcher
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.queue = [[NSOperationQueue alloc] init];
+    self.queue.maxConcurrentOperationCount = kMaxConcurrentReads;
+    self.entries = [NSMapTable mapTableWithKeyOptions:(NSPointerFunctionsStrongMemory |
+                                                       NSPointerFunctionsObjectPointerPersonality)
+                                         valueOptions:NSPointerFunctionsStrongMemory];
+
+    return self;
+}
+
+- (NSMutableDictionary *)entriesForParseBlock:(ResourceContentParseBlock)parseBlock {
+    NSMutableDictionary *pathEntries = [self.entries objectForKey:parseBlock];
+    if (pathEntries == nil) {
+        pathEntries = [NSMutableDictionary dictionary];
+        [self.entries setObject:pathEntries forKey:parseBlock];
+    }
+
+    return pathEntries;
+}
+
+- (void)prefetchContentOfPath:(NSString *)path
+                   parseBlock:(ResourceContentParseBlock)parseBlock {
+    NSMutableDictionary *pathEntries = [self entriesForParseBlock:parseBlock];
+    if (path == nil || pathEntries[path] != nil) {
+        return;
+    }
+
+    ResourceContentPrefetchEntry *entry = [[ResourceContentPrefetchEntry alloc] init];
+    NSOperation *operation = [NSBlockOperation blockOperationWithBlock:^{
+        NSString *errorMessage = nil;
+        entry.content = parseBlock(path, &errorMessage);
+        entry.errorMessage = errorMessage;
+    }];
+    entry.operation = operation;
+    pathEntries[path] = entry;
+    [self.queue addOperation:operation];
+}
+
+- (id)contentOfPath:(NSString *)path
+         parseBlock:(ResourceContentParseBlock)parseBlock
+       errorMessage:(NSString **)errorMessage {
+    errorMessage = errorMessage ?: &(NSString * __autoreleasing){nil};
+
+    NSMutableDictionary *pathEntries = [self entriesForParseBlock:parseBlock];
+    ResourceContentPrefetchEntry *entry = pathEntries[path];
+    if (entry == nil) {
+        return parseBlock(path, errorMessage);
+    }
+
+    [entry.operation waitUntilFinished];
+    // content is owned by the caller from now on
+    [pathEntries removeObjectForKey:path];
+    *errorMessage = entry.errorMessage;
+
+    return entry.content;
+}
+
+@end
@@ -16,7 +16,10 @@
 // under the License.
 
 #import "TextFile.h"
+#import "ReferenceGraph.h"
 
+@class BundleSizeStats;
+@class ResourceContentPrefetcher;
 
 typedef NS_ENUM(unsigned int, ResourceLinterSourceTargetType) {
     ResourceLinterSourceTargetTypeIOS,
@@ -39,16 +42,49 @@ typedef NS_ENUM(unsigned int, ResourceLinterSourceTargetType) {
 @property (nonatomic, readonly, copy) NSArray *knownRegions;
 @property (nonatomic, readonly) ResourceLinterSourceTargetType targetType;
 @property (nonatomic, readonly, copy) NSString *deploymentTarget;
-- (TextFile *)defaultConfigTextFile;
+// array of ConfigLine
+- (NSArray *)defaultConfigLines;
+@end
+
+typedef NS_OPTIONS(NSUInteger, ResourceLinterOptions) {
+    ResourceLinterOptionNone = 0,
+    // warn about bundle resources with identical content
+    ResourceLinterOptionDuplicateContent = 1 << 0,
+    // warn about @2x images not twice the size of @1x and oversized images
+    ResourceLinterOptionImageSizes = 1 << 1,
+    // collect bundleSizeStats
+    ResourceLinterOptionBundleSizes = 1 << 2
+};
+
+@class ResourceLinter;
+
+// told about issues while linting so they can be reported before linting is
+// done. issues matched by an ignore config are not passed, all passed issues
+// are also in the linter arrays when init returns
+@protocol ResourceLinterDelegate <NSObject>
+// config errors and lint errors found while reading config. matchers can
+// add config errors about themselves later, those are only in configErrors
+- (void)resourceLinter:(ResourceLinter *)linter
+didFinishConfigWithConfigErrors:(NSArray *)configErrors
+            lintErrors:(NSArray *)lintErrors;
+// lint warnings and errors found by one matcher, or by all shards when merging
+- (void)resourceLinter:(ResourceLinter *)linter
+didMatchWithLintWarnings:(NSArray *)lintWarnings
+            lintErrors:(NSArray *)lintErrors;
 @end
 
 @interface ResourceLinter : NSObject
 @property(nonatomic, strong, readonly) id<ResourceLinterSource> linterSource;
+@property(nonatomic, assign, readonly) ResourceLinterOptions options;
 @property(nonatomic, strong, readonly) NSMutableArray *defaultConfigs;
 @property(nonatomic, strong, readonly) NSMutableArray *matchers;
 @property(nonatomic, strong, readonly) NSMutableDictionary *bundleResources;
 @property(nonatomic, strong, readonly) NSMutableDictionary *lowercaseBundleResources;
-@property(nonatomic, strong, readonly) NSMutableSet *resourceReferences;
+// interns bundle and reference paths, freed with the linter
+@property(nonatomic, strong, readonly) PathTable *pathTable;
+@property(nonatomic, strong, readonly) ReferenceGraph *referenceGraph;
+// resource content read in background while matching, used by actions
+@property(nonatomic, strong, readonly) ResourceContentPrefetcher *contentPrefetcher;
 @property(nonatomic, strong, readonly) NSMutableArray *missingReferences;
 @property(nonatomic, strong, readonly) NSMutableArray *missingReferencesIgnored;
 @property(nonatomic, strong, readonly) NSMutableArray *unusedResources;
@@ -62,10 +98,46 @@ typedef NS_ENUM(unsigned int, ResourceLinterSourceTargetType) {
 @property(nonatomic, strong, readonly) NSMutableArray *missingIgnoreConfigs;
 @property(nonatomic, strong, readonly) NSMutableArray *warningIgnoreConfigs;
 @property(nonatomic, strong, readonly) NSMutableArray *errorIgnoreConfigs;
+// nil unless ResourceLinterOptionBundleSizes
+@property(nonatomic, strong, readonly) BundleSizeStats *bundleSizeStats;
+// only sources and resources in shard shardIndex of shardCount are matched
+@property(nonatomic, assign, readonly) NSUInteger shardIndex;
+@property(nonatomic, assign, readonly) NSUInteger shardCount;
+// property list with what matching found when sharded, nil otherwise.
+// missing and unused are not collected for a shard
+@property(nonatomic, strong, readonly) NSDictionary *shardRun;
+@property(nonatomic, weak, readonly) id<ResourceLinterDelegate> delegate;
 
 - (instancetype)init NS_UNAVAILABLE;
 - (instancetype)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
                                   configPath:(NSString *)configPath
-                          parseDefaultConfig:(BOOL)parseDefaultConfig NS_DESIGNATED_INITIALIZER;
+                          parseDefaultConfig:(BOOL)parseDefaultConfig;
+- (instancetype)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
+                                  configPath:(NSString *)configPath
+                          parseDefaultConfig:(BOOL)parseDefaultConfig
+                                     options:(ResourceLinterOptions)options;
+// shardRuns is shardRun of all shards to merge instead of matching, shardIndex
+// and shardCount must be 0 and 1 if merging
+- (instancetype)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
+                                  configPath:(NSString *)configPath
+                          parseDefaultConfig:(BOOL)parseDefaultConfig
+                                     options:(ResourceLinterOptions)options
+                                  shardIndex:(NSUInteger)shardIndex
+                                  shardCount:(NSUInteger)shardCount
+                                   shardRuns:(NSArray *)shardRuns;
+// delegate is told about issues while linting in init
+- (instancetype)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
+                                  configPath:(NSString *)configPath
+                          parseDefaultConfig:(BOOL)parseDefaultConfig
+                                     options:(ResourceLinterOptions)options
+                                  shardIndex:(NSUInteger)shardIndex
+                                  shardCount:(NSUInteger)shardCount
+                                   shardRuns:(NSArray *)shardRuns
+                                    delegate:(id<ResourceLinterDelegate>)delegate NS_DESIGNATED_INITIALIZER;
+// NO if path should be matched by some other shard. nothing is matched when
+// merging as it has already been done by the shards
+- (BOOL)shardContainsPath:(NSString *)path;
 - (id)defaultConfigValueForName:(NSString *)name;
+// bundle path with a name within a few typos of path, nil if none
+- (NSString *)suggestedBundleResourcePathForPath:(NSString *)path;
 @end
@@ -32,7 +32,14 @@
 #import "IgnoreConfig.h"
 #import "ConfigError.h"
 #import "DefaultConfig.h"
-#import "NSRegularExpression+lineNumber.h"
+#import "ConfigLine.h"
+#import "DuplicateContentFinder.h"
+#import "ImageHeader.h"
+#import "BundleSizeStats.h"
+#import "ResourceContentPrefetcher.h"
+#import "FuzzyPathIndex.h"
+#import "PathTable.h"
+#import "StageTimings.h"
 #import "NSString+Respect.h"
 
 
@@ -41,8 +48,13 @@ static NSString * const RespectDefaultProjectConfigName = @".respect";
 static NSComparator resourceReferenceComparator = ^NSComparisonResult(id a, id b) {
     ResourceReference *aRef = a;
     ResourceReference *bRef = b;
-    NSComparisonResult r = [aRef.referencePath compare:bRef.referencePath
-                                               options:NSCaseInsensitiveSearch|NSNumericSearch];
+    // same interned path id means same path so skip string compare
+    NSComparisonResult r = NSOrderedSame;
+    if (aRef.referencePathID != bRef.referencePathID) {
+        r = RespectCompareUsingSortKeys(aRef.referencePath, aRef.referencePathSortKey,
+                                        bRef.referencePath, bRef.referencePathSortKey);
+    }
+
     if (r == NSOrderedSame) {
         r = aRef.referenceLocation.lineNumber - bRef.referenceLocation.lineNumber;
     }
@@ -56,9 +68,9 @@ static NSComparator resourceReferenceComparator = ^NSComparisonResult(id a, id b
         r = aRef.referenceLocation.inLineRange.location - bRef.referenceLocation.inLineRange.location;
     }
 
-    if (r == NSOrderedSame) {
-        r = [aRef.resourcePath compare:bRef.resourcePath
-                               options:NSCaseInsensitiveSearch|NSNumericSearch];
+    if (r == NSOrderedSame && aRef.resourcePathID != bRef.resourcePathID) {
+        r = RespectCompareUsingSortKeys(aRef.resourcePath, aRef.resourcePathSortKey,
+                                        bRef.resourcePath, bRef.resourcePathSortKey);
     }
 
     return r;
@@ -67,8 +79,12 @@ static NSComparator resourceReferenceComparator = ^NSComparisonResult(id a, id b
 static NSComparator bundleResourceComparator = ^NSComparisonResult(id a, id b) {
     BundleResource *aRes = a;
     BundleResource *bRes = b;
-    return [aRes.path compare:bRes.path
-                      options:NSCaseInsensitiveSearch|NSNumericSearch];
+    if (aRes.pathID == bRes.pathID) {
+        return NSOrderedSame;
+    }
+
+    return RespectCompareUsingSortKeys(aRes.path, aRes.pathSortKey,
+                                       bRes.path, bRes.pathSortKey);
 
 };
 
@@ -87,6 +103,72 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
 
 };
 
+// paths inside source root are stored relative to it in shard runs so that
+// shards can run in different checkouts
+static NSString *shard_path_from_path(NSString *path, NSString *sourceRoot) {
+    NSString *prefix = ([sourceRoot hasSuffix:@"/"] ?
+                        sourceRoot :
+                        [sourceRoot stringByAppendingString:@"/"]);
+    if (path == nil || sourceRoot == nil || ![path hasPrefix:prefix]) {
+        return path;
+    }
+
+    return [path substringFromIndex:prefix.length];
+}
+
+static NSString *path_from_shard_path(NSString *shardPath, NSString *sourceRoot) {
+    if (shardPath == nil || sourceRoot == nil || shardPath.absolutePath) {
+        return shardPath;
+    }
+
+    return [sourceRoot stringByAppendingPathComponent:shardPath];
+}
+
+#define FNV1A_OFFSET_BASIS 0xcbf29ce484222325ULL
+
+static uint64_t fnv1a_string(uint64_t hash, NSString *string) {
+    for (const char *p = string.UTF8String; p != NULL && *p != '\0'; p++) {
+        hash ^= (unsigned char)*p;
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// FNV-1a of path so that all shards agree without coordinating
+static NSUInteger shard_of_shard_path(NSString *shardPath, NSUInteger shardCount) {
+    if (shardPath == nil) {
+        return 0;
+    }
+    // absolute paths outside source root differ between checkouts, use name
+    NSString *key = shardPath.absolutePath ? shardPath.lastPathComponent : shardPath;
+
+    return (NSUInteger)(fnv1a_string(FNV1A_OFFSET_BASIS, key) % shardCount);
+}
+
+static NSArray *shard_text_file_errors(NSArray *errors, NSString *sourceRoot) {
+    NSMutableArray *shardErrors = [NSMutableArray array];
+    for (TextFileError *error in errors) {
+        NSMutableDictionary *shardError = [NSMutableDictionary dictionary];
+        if (error.file != nil) {
+            shardError[@"file"] = shard_path_from_path(error.file, sourceRoot);
+        }
+        shardError[@"line"] = @(error.textLocation.lineNumber);
+        shardError[@"location"] = @(error.textLocation.inLineRange.location);
+        shardError[@"length"] = @(error.textLocation.inLineRange.length);
+        shardError[@"message"] = error.message ?: @"";
+        [shardErrors addObject:shardError];
+    }
+
+    return shardErrors;
+}
+
+static TextLocation text_location_from_shard_dictionary(NSDictionary *dictionary) {
+    return MakeTextLocation([dictionary[@"line"] unsignedIntegerValue],
+                            NSMakeRange([dictionary[@"location"] unsignedIntegerValue],
+                                        [dictionary[@"length"] unsignedIntegerValue]));
+}
+
 
 @interface ResourceLinter ()
 @property(nonatomic, copy, readwrite) NSString *configPath;
@@ -98,11 +180,14 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
 @property(nonatomic, strong, readwrite) NSMutableArray *matchers;
 @property(nonatomic, strong, readwrite) NSMutableDictionary *bundleResources;
 @property(nonatomic, strong, readwrite) NSMutableDictionary *lowercaseBundleResources;
-@property(nonatomic, strong, readwrite) NSMutableSet *resourceReferences;
+@property(nonatomic, strong, readwrite) PathTable *pathTable;
+@property(nonatomic, strong, readwrite) ReferenceGraph *referenceGraph;
+@property(nonatomic, strong, readwrite) ResourceContentPrefetcher *contentPrefetcher;
 @property(nonatomic, strong, readwrite) NSMutableArray *missingReferences;
 @property(nonatomic, strong, readwrite) NSMutableArray *missingReferencesIgnored;
 @property(nonatomic, strong, readwrite) NSMutableArray *unusedResources;
 @property(nonatomic, strong, readwrite) NSMutableArray *unusedResourcesIgnored;
+@property(nonatomic, assign, readwrite) ResourceLinterOptions options;
 @property(nonatomic, strong, readwrite) NSMutableArray *lintWarnings;
 @property(nonatomic, strong, readwrite) NSMutableArray *lintWarningsIgnored;
 @property(nonatomic, strong, readwrite) NSMutableArray *lintErrors;
@@ -112,6 +197,14 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
 @property(nonatomic, strong, readwrite) NSMutableArray *missingIgnoreConfigs;
 @property(nonatomic, strong, readwrite) NSMutableArray *warningIgnoreConfigs;
 @property(nonatomic, strong, readwrite) NSMutableArray *errorIgnoreConfigs;
+@property(nonatomic, strong, readwrite) BundleSizeStats *bundleSizeStats;
+@property(nonatomic, assign, readwrite) NSUInteger shardIndex;
+@property(nonatomic, assign, readwrite) NSUInteger shardCount;
+@property(nonatomic, strong, readwrite) NSDictionary *shardRun;
+@property(nonatomic, copy, readwrite) NSArray *shardRuns;
+@property(nonatomic, weak, readwrite) id<ResourceLinterDelegate> delegate;
+// built on first missing resource suggestion
+@property(nonatomic, strong, readwrite) FuzzyPathIndex *bundleResourcesIndex;
 @end
 
 @implementation ResourceLinter
@@ -119,12 +212,61 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
 - (id)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
                         configPath:(NSString *)configPath
                 parseDefaultConfig:(BOOL)parseDefaultConfig {
+    return [self initWithResourceLinterSource:linterSource
+                                   configPath:configPath
+                           parseDefaultConfig:parseDefaultConfig
+                                      options:ResourceLinterOptionNone];
+}
+
+- (id)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
+                        configPath:(NSString *)configPath
+                parseDefaultConfig:(BOOL)parseDefaultConfig
+                           options:(ResourceLinterOptions)options {
+    return [self initWithResourceLinterSource:linterSource
+                                   configPath:configPath
+                           parseDefaultConfig:parseDefaultConfig
+                                      options:options
+                                   shardIndex:0
+                                   shardCount:1
+                                    shardRuns:nil];
+}
+
+- (id)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
+                        configPath:(NSString *)configPath
+                parseDefaultConfig:(BOOL)parseDefaultConfig
+                           options:(ResourceLinterOptions)options
+                        shardIndex:(NSUInteger)shardIndex
+                        shardCount:(NSUInteger)shardCount
+                         shardRuns:(NSArray *)shardRuns {
+    return [self initWithResourceLinterSource:linterSource
+                                   configPath:configPath
+                           parseDefaultConfig:parseDefaultConfig
+                                      options:options
+                                   shardIndex:shardIndex
+                                   shardCount:shardCount
+                                    shardRuns:shardRuns
+                                     delegate:nil];
+}
+
+- (id)initWithResourceLinterSource:(id<ResourceLinterSource>)linterSource
+                        configPath:(NSString *)configPath
+                parseDefaultConfig:(BOOL)parseDefaultConfig
+                           options:(ResourceLinterOptions)options
+                        shardIndex:(NSUInteger)shardIndex
+                        shardCount:(NSUInteger)shardCount
+                         shardRuns:(NSArray *)shardRuns
+                          delegate:(id<ResourceLinterDelegate>)delegate {
     self = [super init];
     if (self == nil) {
         return nil;
     }
 
     self.linterSource = linterSource;
+    self.options = options;
+    self.shardIndex = shardIndex;
+    self.shardCount = MAX(shardCount, 1);
+    self.shardRuns = shardRuns;
+    self.delegate = delegate;
 
     self.configPath = configPath;
     self.parseDefaultConfig = parseDefaultConfig;
@@ -134,7 +276,9 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
     self.matchers = [NSMutableArray array];
     self.bundleResources = [NSMutableDictionary dictionary];
     self.lowercaseBundleResources = [NSMutableDictionary dictionary];
-    self.resourceReferences = [NSMutableSet set];
+    self.pathTable = [[PathTable alloc] init];
+    self.referenceGraph = [[ReferenceGraph alloc] initWithPathTable:self.pathTable];
+    self.contentPrefetcher = [[ResourceContentPrefetcher alloc] init];
     self.missingReferences = [NSMutableArray array];
     self.missingReferencesIgnored = [NSMutableArray array];
     self.unusedResources = [NSMutableArray array];
@@ -160,7 +304,12 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
 
 - (void)parseConfigInTextFile:(TextFile *)textFile
           isDefaultConfigFile:(BOOL)isDefaultConfigFile {
-    static NSRegularExpression *re = nil;
+    [self addConfigLines:[ConfigLine configLinesInTextFile:textFile]
+     isDefaultConfigFile:isDefaultConfigFile];
+}
+
+- (void)addConfigLines:(NSArray *)configLines
+   isDefaultConfigFile:(BOOL)isDefaultConfigFile {
     static NSDictionary *nameToClass = nil;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
@@ -175,123 +324,107 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
                         @"IgnoreUnused": [IgnoreConfig class],
                         @"IgnoreWarning": [IgnoreConfig class],
                         @"IgnoreError": [IgnoreConfig class]};
-
-        re = [NSRegularExpression
-              // capture group 1 is name
-              // capture group 2 is "Default" optionally
-              // capture group 3 is separator
-              // capture group 4 is argument
-              regularExpressionWithPattern:@"@Lint([A-Za-z]+?)(Default)?(:| )(.*+)"
-              options:0
-              error:NULL];
     });
 
-    __block AbstractMatch *currentMatcher = nil;
-    __block NSUInteger prevConfigLine = 0;
-    [re enumerateMatchesWithLineNumberInString:textFile.text
-                                       options:0
-                                         range:NSMakeRange(0, (textFile.text).length)
-                                    lineRanges:textFile.lineRanges
-                                    usingBlock:
-     ^(NSTextCheckingResult *result, NSUInteger lineNumber, NSRange inLineRange,
-       NSMatchingFlags flags, BOOL *stop) {
-         TextLocation textLocation = MakeTextLocation(lineNumber, inLineRange);
-         NSString *name = [textFile.text substringWithRange:[result rangeAtIndex:1]];
-         BOOL isDefault = [result rangeAtIndex:2].location != NSNotFound;
-         NSString *separator = [textFile.text substringWithRange:[result rangeAtIndex:3]];
-         NSString *argument = [[textFile.text substringWithRange:[result rangeAtIndex:4]]
-                               respect_stringByTrimmingWhitespace];
-
-         if (![separator isEqualToString:@":"]) {
-             NSString *message = [NSString stringWithFormat:
-                                  @"Missing colon, did you mean @Lint%@: %@?",
-                                  name, argument];
-             [self.configErrors addObject:
-              [ConfigError configErrorWithFile:textFile.path
-                                  textLocation:textLocation
-                                       message:message]];
-             return;
-         }
-
-         Class nameClass = nameToClass[name];
-         if (nameClass != nil) {
-             if (isDefault) {
-                 id defaultValue = nil;
-                 NSString *errorMessage = nil;
-                 defaultValue = [nameClass defaultConfigValueFromArgument:argument
-                                                             errorMessage:&errorMessage];
-
-                 [self.defaultConfigs addObject:[DefaultConfig
-                                                 defaultWithLinter:self
-                                                 file:textFile.path
-                                                 textLocation:textLocation
-                                                 name:name
-                                                 argumentString:argument
-                                                 configValue:defaultValue
-                                                 errorMessage:errorMessage]];
-             } else {
-                 id nameObject = [nameClass alloc];
-
-                 if ([nameObject isKindOfClass:[AbstractMatch class]]) {
-                     currentMatcher = [nameObject
-                                       initWithLinter:self
-                                       file:textFile.path
-                                       textLocation:textLocation
-                                       argumentString:argument
-                                       isDefaultConfig:isDefaultConfigFile];
-                     [self.matchers addObject:currentMatcher];
-                 } else if ([nameObject isKindOfClass:[AbstractAction class]]) {
-                     AbstractAction *action = [nameObject
-                                               initWithLinter:self
-                                               file:textFile.path
-                                               textLocation:textLocation
-                                               argumentString:argument
-                                               isDefaultConfig:isDefaultConfigFile];
-
-                     // if no current matcher or current line is not directly
-                     // after a matcher or action line then add as static
-                     if (currentMatcher == nil || prevConfigLine != lineNumber-1) {
-                         currentMatcher = nil;
-                         [self.staticMatcher addAction:action];
-                     } else {
-                         [currentMatcher addAction:action];
-                     }
-                 } else {
-                     IgnoreConfig *ignoreConfig = [nameObject
-                                                   initWithLinter:self
-                                                   file:textFile.path
-                                                   textLocation:textLocation
-                                                   type:name
-                                                   argumentString:argument];
-                     if ([name isEqualToString:@"IgnoreMissing"]) {
-                         [self.missingIgnoreConfigs addObject:ignoreConfig];
-                     } else if ([name isEqualToString:@"IgnoreUnused"]) {
-                         [self.unusedIgnoreConfigs addObject:ignoreConfig];
-                     } else if ([name isEqualToString:@"IgnoreWarning"]) {
-                         [self.warningIgnoreConfigs addObject:ignoreConfig];
-                     } else if ([name isEqualToString:@"IgnoreError"]) {
-                         [self.errorIgnoreConfigs addObject:ignoreConfig];
-                     } else {
-                         NSAssert(0, @"");
-                     }
-                 }
-             }
-         } else {
-             NSString *suggestedName = [name respect_stringBySuggestionFromArray:nameToClass.allKeys
-                                                            maxDistanceThreshold:3];
-             NSString *message = (suggestedName ?
-                                  [NSString stringWithFormat:
-                                   @"Did you mean @Lint%@?", suggestedName] :
-                                  [NSString stringWithFormat:
-                                   @"Unknown config @Lint%@", name]);
-             [self.configErrors addObject:
-              [ConfigError configErrorWithFile:textFile.path
-                                  textLocation:textLocation
-                                       message:message]];
-         }
-
-         prevConfigLine = lineNumber;
-     }];
+    AbstractMatch *currentMatcher = nil;
+    NSUInteger prevConfigLine = 0;
+    for (ConfigLine *configLine in configLines) {
+        NSString *file = configLine.file;
+        TextLocation textLocation = configLine.textLocation;
+        NSUInteger lineNumber = textLocation.lineNumber;
+        NSString *name = configLine.name;
+        NSString *argument = configLine.argument;
+
+        if (![configLine.separator isEqualToString:@":"]) {
+            NSString *message = [NSString stringWithFormat:
+                                 @"Missing colon, did you mean @Lint%@: %@?",
+                                 name, argument];
+            [self.configErrors addObject:
+             [ConfigError configErrorWithFile:file
+                                 textLocation:textLocation
+                                      message:message]];
+            continue;
+        }
+
+        Class nameClass = nameToClass[name];
+        if (nameClass != nil) {
+            if (configLine.isDefault) {
+                id defaultValue = nil;
+                NSString *errorMessage = nil;
+                defaultValue = [nameClass defaultConfigValueFromArgument:argument
+                                                            errorMessage:&errorMessage];
+
+                [self.defaultConfigs addObject:[DefaultConfig
+                                                defaultWithLinter:self
+                                                file:file
+                                                textLocation:textLocation
+                                                name:name
+                                                argumentString:argument
+                                                configValue:defaultValue
+                                                errorMessage:errorMessage]];
+            } else {
+                id nameObject = [nameClass alloc];
+
+                if ([nameObject isKindOfClass:[AbstractMatch class]]) {
+                    currentMatcher = [nameObject
+                                      initWithLinter:self
+                                      file:file
+                                      textLocation:textLocation
+                                      argumentString:argument
+                                      isDefaultConfig:isDefaultConfigFile];
+                    [self.matchers addObject:currentMatcher];
+                } else if ([nameObject isKindOfClass:[AbstractAction class]]) {
+                    AbstractAction *action = [nameObject
+                                              initWithLinter:self
+                                              file:file
+                                              textLocation:textLocation
+                                              argumentString:argument
+                                              isDefaultConfig:isDefaultConfigFile];
+
+                    // if no current matcher or current line is not directly
+                    // after a matcher or action line then add as static
+                    if (currentMatcher == nil || prevConfigLine != lineNumber-1) {
+                        currentMatcher = nil;
+                        [self.staticMatcher addAction:action];
+                    } else {
+                        [currentMatcher addAction:action];
+                    }
+                } else {
+                    IgnoreConfig *ignoreConfig = [nameObject
+                                                  initWithLinter:self
+                                                  file:file
+                                                  textLocation:textLocation
+                                                  type:name
+                                                  argumentString:argument];
+                    if ([name isEqualToString:@"IgnoreMissing"]) {
+                        [self.missingIgnoreConfigs addObject:ignoreConfig];
+                    } else if ([name isEqualToString:@"IgnoreUnused"]) {
+                        [self.unusedIgnoreConfigs addObject:ignoreConfig];
+                    } else if ([name isEqualToString:@"IgnoreWarning"]) {
+                        [self.warningIgnoreConfigs addObject:ignoreConfig];
+                    } else if ([name isEqualToString:@"IgnoreError"]) {
+                        [self.errorIgnoreConfigs addObject:ignoreConfig];
+                    } else {
+                        NSAssert(0, @"");
+                    }
+                }
+            }
+        } else {
+            NSString *suggestedName = [name respect_stringBySuggestionFromArray:nameToClass.allKeys
+                                                           maxDistanceThreshold:3];
+            NSString *message = (suggestedName ?
+                                 [NSString stringWithFormat:
+                                  @"Did you mean @Lint%@?", suggestedName] :
+                                 [NSString stringWithFormat:
+                                  @"Unknown config @Lint%@", name]);
+            [self.configErrors addObject:
+             [ConfigError configErrorWithFile:file
+                                 textLocation:textLocation
+                                      message:message]];
+        }
+
+        prevConfigLine = lineNumber;
+    }
 }
 
 + (BOOL)matchesSomeIgnoreConfig:(NSArray *)ignoreConfigs
@@ -305,6 +438,46 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
     return NO;
 }
 
+// lint warnings or errors not ignored by ignoreConfigs in report order
+- (NSArray *)notIgnoredIssues:(NSArray *)issues
+                ignoreConfigs:(NSArray *)ignoreConfigs
+                   comparator:(NSComparator)comparator {
+    NSMutableArray *notIgnored = [NSMutableArray array];
+    for (TextFileError *issue in issues) {
+        if (![[self class]
+              matchesSomeIgnoreConfig:ignoreConfigs
+              usingString:[issue.file respect_stringRelativeToPathPrefix:
+                           [self.linterSource sourceRoot]]]) {
+                  [notIgnored addObject:issue];
+              }
+    }
+    [notIgnored sortUsingComparator:comparator];
+
+    return notIgnored;
+}
+
+// tell delegate about warnings and errors added since index
+- (void)didMatchWarningsFromIndex:(NSUInteger)warningsIndex
+                  errorsFromIndex:(NSUInteger)errorsIndex {
+    if (self.delegate == nil ||
+        (self.lintWarnings.count == warningsIndex &&
+         self.lintErrors.count == errorsIndex)) {
+        return;
+    }
+
+    NSRange warningsRange = NSMakeRange(warningsIndex, self.lintWarnings.count - warningsIndex);
+    NSRange errorsRange = NSMakeRange(errorsIndex, self.lintErrors.count - errorsIndex);
+    [self.delegate resourceLinter:self
+         didMatchWithLintWarnings:[self notIgnoredIssues:[self.lintWarnings
+                                                          subarrayWithRange:warningsRange]
+                                           ignoreConfigs:self.warningIgnoreConfigs
+                                              comparator:lintWarningComparator]
+                       lintErrors:[self notIgnoredIssues:[self.lintErrors
+                                                          subarrayWithRange:errorsRange]
+                                           ignoreConfigs:self.errorIgnoreConfigs
+                                              comparator:fileSourcedErrorComparator]];
+}
+
 - (void)parseConfig {
     TextFile *configTextFile = nil;
 
@@ -332,38 +505,100 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
 }
 
 - (void)lint {
+    StageTimings *timings = [StageTimings sharedTimings];
+
+    [timings startStage:@"config"];
     NSDictionary *resources = [self.linterSource resources];
+    PathTable *pathTable = self.pathTable;
 
     // add all bundle resources
     for (NSString *bundlePath in resources) {
         BundleResource *bundleRes = [[BundleResource alloc]
                                      initWithBuildSourcePath:resources[bundlePath]
-                                     path:bundlePath];
+                                     path:bundlePath
+                                     pathTable:pathTable];
 
-        self.bundleResources[bundlePath] = bundleRes;
-        self.lowercaseBundleResources[bundlePath.lowercaseString] = bundleRes;
+        self.bundleResources[bundleRes.path] = bundleRes;
+        // interned so that already lowercase paths share the same string
+        self.lowercaseBundleResources[[pathTable internedPath:
+                                       bundlePath.lowercaseString]] = bundleRes;
     }
 
     // find matchers, actions and ignore config
     if (self.parseDefaultConfig) {
-        [self parseConfigInTextFile:[self.linterSource defaultConfigTextFile]
-                isDefaultConfigFile:YES];
+        [self addConfigLines:[self.linterSource defaultConfigLines]
+         isDefaultConfigFile:YES];
     }
 
     [self parseConfig];
 
     for (TextFile *sourceTextFile in [[self.linterSource sourceTextFiles]
                                       objectEnumerator]) {
-        [self parseConfigInTextFile:sourceTextFile isDefaultConfigFile:NO];
+        @autoreleasepool {
+            [self parseConfigInTextFile:sourceTextFile isDefaultConfigFile:NO];
+        }
+    }
+    [timings stopStage:@"config"];
+
+    // errors found reading config are final now and can be reported while
+    // matching
+    if (self.delegate != nil) {
+        [self.delegate resourceLinter:self
+      didFinishConfigWithConfigErrors:[self.configErrors sortedArrayUsingComparator:
+                                       fileSourcedErrorComparator]
+                           lintErrors:[self notIgnoredIssues:self.lintErrors
+                                               ignoreConfigs:self.errorIgnoreConfigs
+                                                  comparator:fileSourcedErrorComparator]];
+    }
+
+    // start reading resource content consumed by actions so that it overlaps
+    // with matching instead of each action reading when triggered
+    if (self.shardRuns == nil) {
+        for (AbstractMatch *matcher in self.matchers) {
+            for (AbstractAction *action in matcher.actions) {
+                [action prefetchResourceContent];
+            }
+        }
+    }
+    if ((self.options & ResourceLinterOptionImageSizes) && self.shardCount == 1) {
+        [self prefetchImageHeaders];
     }
 
     // run matchers and trigger actions
+    [timings startStage:@"match"];
+    NSUInteger configStageWarningsCount = self.lintWarnings.count;
+    NSUInteger configStageErrorsCount = self.lintErrors.count;
+    if (self.shardRuns != nil) {
+        [self addShardRuns];
+        [self didMatchWarningsFromIndex:configStageWarningsCount
+                        errorsFromIndex:configStageErrorsCount];
+    }
+    // when merging matchers match nothing but still report matchers without
+    // actions or without matches using merged match counts
     for (AbstractMatch *matcher in self.matchers) {
-        [matcher performMatch];
+        NSUInteger warningsIndex = self.lintWarnings.count;
+        NSUInteger errorsIndex = self.lintErrors.count;
+        @autoreleasepool {
+            [matcher performMatch];
+            for (AbstractAction *action in matcher.actions) {
+                [action finishMatch];
+            }
+        }
+        [self didMatchWarningsFromIndex:warningsIndex errorsFromIndex:errorsIndex];
     }
+    [timings stopStage:@"match"];
+
+    if (self.shardCount > 1) {
+        // missing and unused are only known when all shards are merged
+        self.shardRun = [self shardRunWithWarningsFromIndex:configStageWarningsCount
+                                           errorsFromIndex:configStageErrorsCount];
+        return;
+    }
+
+    [timings startStage:@"collect"];
 
     // collect missing references
-    for (ResourceReference *resourceRef in self.resourceReferences) {
+    for (ResourceReference *resourceRef in self.referenceGraph.references) {
         if ((resourceRef.bundleResources).count > 0) {
             continue;
         }
@@ -375,8 +610,11 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
             [self.missingReferences addObject:resourceRef];
         }
     }
-    [self.missingReferences sortUsingComparator:resourceReferenceComparator];
-    [self.missingReferencesIgnored sortUsingComparator:resourceReferenceComparator];
+    // comparators only read precomputed keys so safe to sort concurrently
+    [self.missingReferences sortWithOptions:NSSortConcurrent|NSSortStable
+                            usingComparator:resourceReferenceComparator];
+    [self.missingReferencesIgnored sortWithOptions:NSSortConcurrent|NSSortStable
+                                   usingComparator:resourceReferenceComparator];
 
     // collect unused resources
     for (BundleResource *bundleRes in [self.bundleResources objectEnumerator]) {
@@ -391,13 +629,21 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
             [self.unusedResources addObject:bundleRes];
         }
     }
-    [self.unusedResources sortUsingComparator:bundleResourceComparator];
-    [self.unusedResourcesIgnored sortUsingComparator:bundleResourceComparator];
+    [self.unusedResources sortWithOptions:NSSortConcurrent|NSSortStable
+                          usingComparator:bundleResourceComparator];
+    [self.unusedResourcesIgnored sortWithOptions:NSSortConcurrent|NSSortStable
+                                 usingComparator:bundleResourceComparator];
 
     // move ignored errors and warnings into *Ignored array
 
     // add lint warnings from source
     [self.lintWarnings addObjectsFromArray:[self.linterSource lintWarnings]];
+    if (self.options & ResourceLinterOptionDuplicateContent) {
+        [self addDuplicateContentWarnings];
+    }
+    if (self.options & ResourceLinterOptionImageSizes) {
+        [self addImageSizeWarnings];
+    }
     for (LintWarning *lintWarning in self.lintWarnings) {
         if ([[self class]
              matchesSomeIgnoreConfig:self.warningIgnoreConfigs
@@ -425,6 +671,125 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
     [self.lintErrorsIgnored sortUsingComparator:fileSourcedErrorComparator];
 
     [self.configErrors sortUsingComparator:fileSourcedErrorComparator];
+    [timings stopStage:@"collect"];
+
+    if (self.options & ResourceLinterOptionBundleSizes) {
+        [timings startStage:@"sizes"];
+        self.bundleSizeStats = [[BundleSizeStats alloc] initWithLinter:self];
+        [timings stopStage:@"sizes"];
+    }
+}
+
+- (void)addDuplicateContentWarnings {
+    NSArray *groups = [DuplicateContentFinder duplicateGroupsInBundleResources:
+                       [self.bundleResources allValues]];
+    for (NSArray *group in groups) {
+        BundleResource *firstRes = group[0];
+        for (NSUInteger i = 1; i < group.count; i++) {
+            BundleResource *bundleRes = group[i];
+            [self.lintWarnings addObject:
+             [LintWarning lintWarningWithFile:bundleRes.buildSourcePath
+                                      message:[NSString stringWithFormat:
+                                               @"Bundle path \"%@\" has same content as \"%@\"",
+                                               bundleRes.path, firstRes.path]]];
+        }
+    }
+}
+
+// scale from @<n>x in filename, unscaledPath is path without it
+static NSUInteger image_scale(NSString *path, NSString **unscaledPath) {
+    NSString *name = path.lastPathComponent.stringByDeletingPathExtension;
+    NSRange scaleRange = [name rangeOfString:@"@[1-9]x"
+                                     options:NSRegularExpressionSearch];
+    if (scaleRange.location == NSNotFound) {
+        *unscaledPath = path;
+        return 1;
+    }
+
+    *unscaledPath = [[path.stringByDeletingLastPathComponent
+                      stringByAppendingPathComponent:
+                      [name stringByReplacingCharactersInRange:scaleRange withString:@""]]
+                     stringByAppendingPathExtension:path.pathExtension];
+    return (NSUInteger)([name characterAtIndex:scaleRange.location + 1] - '0');
+}
+
+static ResourceContentParseBlock imageHeaderParseBlock = ^id(NSString *path, NSString **errorMessage) {
+    return [ImageHeader imageHeaderWithContentsOfFile:path];
+};
+
+- (NSArray *)imageResources {
+    NSSet *imageExtensions = [NSSet setWithArray:@[@"png", @"jpg", @"jpeg", @"gif"]];
+    NSMutableArray *imageResources = [NSMutableArray array];
+    for (BundleResource *bundleRes in [self.bundleResources objectEnumerator]) {
+        if ([imageExtensions containsObject:bundleRes.path.pathExtension.lowercaseString]) {
+            [imageResources addObject:bundleRes];
+        }
+    }
+
+    return imageResources;
+}
+
+- (void)prefetchImageHeaders {
+    for (BundleResource *bundleRes in [self imageResources]) {
+        [self.contentPrefetcher prefetchContentOfPath:bundleRes.buildSourcePath
+                                           parseBlock:imageHeaderParseBlock];
+    }
+}
+
+- (void)addImageSizeWarnings {
+    // only headers are read, unreadable or unknown formats are skipped
+    NSMutableDictionary *imageHeaders = [NSMutableDictionary dictionary];
+    for (BundleResource *bundleRes in [self imageResources]) {
+        ImageHeader *imageHeader = [self.contentPrefetcher
+                                    contentOfPath:bundleRes.buildSourcePath
+                                    parseBlock:imageHeaderParseBlock
+                                    errorMessage:NULL];
+        if (imageHeader != nil) {
+            imageHeaders[bundleRes.path] = imageHeader;
+        }
+    }
+
+    for (NSString *path in imageHeaders) {
+        BundleResource *bundleRes = self.bundleResources[path];
+        ImageHeader *imageHeader = imageHeaders[path];
+        NSString *unscaledPath = nil;
+        NSUInteger scale = image_scale(path, &unscaledPath);
+
+        ImageHeader *unscaledHeader = imageHeaders[unscaledPath];
+        if (scale > 1 && unscaledHeader != nil &&
+            (imageHeader.pixelWidth != unscaledHeader.pixelWidth * scale ||
+             imageHeader.pixelHeight != unscaledHeader.pixelHeight * scale)) {
+            [self.lintWarnings addObject:
+             [LintWarning lintWarningWithFile:bundleRes.buildSourcePath
+                                      message:[NSString stringWithFormat:
+                                               @"Bundle path \"%@\" is %lux%lu pixels, "
+                                               @"expected %lux%lu for %lux%lu \"%@\"",
+                                               path,
+                                               imageHeader.pixelWidth,
+                                               imageHeader.pixelHeight,
+                                               unscaledHeader.pixelWidth * scale,
+                                               unscaledHeader.pixelHeight * scale,
+                                               unscaledHeader.pixelWidth,
+                                               unscaledHeader.pixelHeight,
+                                               unscaledPath]]];
+        }
+
+        // largest screen side in points, iPhone 5 and iPad
+        NSUInteger maxPoints = ([path rangeOfString:@"~iphone"].location != NSNotFound ?
+                                568 : 1024);
+        NSUInteger points = MAX(imageHeader.pixelWidth, imageHeader.pixelHeight) / scale;
+        if (points > maxPoints) {
+            [self.lintWarnings addObject:
+             [LintWarning lintWarningWithFile:bundleRes.buildSourcePath
+                                      message:[NSString stringWithFormat:
+                                               @"Bundle path \"%@\" is %lux%lu pixels, "
+                                               @"larger than any screen at @%lux",
+                                               path,
+                                               imageHeader.pixelWidth,
+                                               imageHeader.pixelHeight,
+                                               scale]]];
+        }
+    }
 }
 
 - (id)defaultConfigValueForName:(NSString *)name {
@@ -438,4 +803,200 @@ static NSComparator fileSourcedErrorComparator = ^NSComparisonResult(id a, id b)
     return nil;
 }
 
+- (NSString *)suggestedBundleResourcePathForPath:(NSString *)path {
+    // allow about one typo per four characters of the name, short names would
+    // otherwise match almost anything
+    NSUInteger maxDistance = MIN((NSUInteger)3,
+                                 path.lastPathComponent.stringByDeletingPathExtension.length / 4);
+    if (maxDistance == 0) {
+        return nil;
+    }
+
+    if (self.bundleResourcesIndex == nil) {
+        self.bundleResourcesIndex = [[FuzzyPathIndex alloc]
+                                     initWithPaths:[self.bundleResources.allKeys
+                                                    sortedArrayUsingSelector:@selector(compare:)]];
+    }
+
+    NSArray *paths = [self.bundleResourcesIndex pathsNearPath:path maxDistance:maxDistance];
+
+    return paths.count > 0 ? paths[0] : nil;
+}
+
+- (BOOL)shardContainsPath:(NSString *)path {
+    if (self.shardRuns != nil) {
+        return NO;
+    }
+    if (self.shardCount == 1) {
+        return YES;
+    }
+
+    NSString *shardPath = shard_path_from_path(path, [self.linterSource sourceRoot]);
+    return shard_of_shard_path(shardPath, self.shardCount) == self.shardIndex;
+}
+
+- (NSDictionary *)shardRunWithWarningsFromIndex:(NSUInteger)warningsIndex
+                                errorsFromIndex:(NSUInteger)errorsIndex {
+    NSString *sourceRoot = [self.linterSource sourceRoot];
+
+    // matchers are the same and in same order for all shards as config is
+    // parsed from all sources, so index is enough to identify one
+    NSMutableArray *matchCounts = [NSMutableArray array];
+    for (AbstractMatch *matcher in self.matchers) {
+        [matchCounts addObject:@(matcher.matchCount)];
+    }
+
+    NSMutableArray *references = [NSMutableArray array];
+    for (ResourceReference *resourceRef in self.referenceGraph.references) {
+        NSMutableDictionary *reference = [NSMutableDictionary dictionary];
+        reference[@"resource"] = resourceRef.resourcePath;
+        if (resourceRef.referencePath != nil) {
+            reference[@"reference"] = shard_path_from_path(resourceRef.referencePath, sourceRoot);
+        }
+        reference[@"line"] = @(resourceRef.referenceLocation.lineNumber);
+        reference[@"location"] = @(resourceRef.referenceLocation.inLineRange.location);
+        reference[@"length"] = @(resourceRef.referenceLocation.inLineRange.length);
+        if (resourceRef.referenceHint != nil) {
+            reference[@"hint"] = resourceRef.referenceHint;
+        }
+        if (resourceRef.missingResourceHint != nil) {
+            reference[@"missingHint"] = resourceRef.missingResourceHint;
+        }
+        [references addObject:reference];
+    }
+
+    NSMutableDictionary *bundleMatchers = [NSMutableDictionary dictionary];
+    for (BundleResource *bundleRes in [self.bundleResources objectEnumerator]) {
+        if (bundleRes.matchers.count == 0) {
+            continue;
+        }
+
+        NSMutableArray *matcherIndexes = [NSMutableArray array];
+        for (AbstractMatch *matcher in bundleRes.matchers) {
+            [matcherIndexes addObject:@([self.matchers indexOfObjectIdenticalTo:matcher])];
+        }
+        bundleMatchers[bundleRes.path] = matcherIndexes;
+    }
+
+    NSRange warningsRange = NSMakeRange(warningsIndex, self.lintWarnings.count - warningsIndex);
+    NSRange errorsRange = NSMakeRange(errorsIndex, self.lintErrors.count - errorsIndex);
+
+    return @{@"project": [self.linterSource projectName] ?: @"",
+             @"target": [self.linterSource targetName] ?: @"",
+             @"configuration": [self.linterSource configurationName] ?: @"",
+             @"fingerprint": [self configFingerprint],
+             @"matchCounts": matchCounts,
+             @"references": references,
+             @"bundleMatchers": bundleMatchers,
+             @"lintWarnings": shard_text_file_errors([self.lintWarnings
+                                                      subarrayWithRange:warningsRange],
+                                                     sourceRoot),
+             @"lintErrors": shard_text_file_errors([self.lintErrors
+                                                    subarrayWithRange:errorsRange],
+                                                   sourceRoot)};
+}
+
+// hash of matcher and action config lines and options, shard runs are only
+// merged if linted with the same fingerprint as matchers are identified by index
+- (NSString *)configFingerprint {
+    NSString *sourceRoot = [self.linterSource sourceRoot];
+    // duplicates and sizes are only done when merging so can differ
+    ResourceLinterOptions options = self.options & ~(ResourceLinterOptionDuplicateContent |
+                                                     ResourceLinterOptionImageSizes |
+                                                     ResourceLinterOptionBundleSizes);
+    uint64_t hash = fnv1a_string(FNV1A_OFFSET_BASIS,
+                                 [NSString stringWithFormat:@"%lu\n",
+                                  (unsigned long)options]);
+    uint64_t (^addConfig)(uint64_t, NSString *, TextLocation, NSString *) =
+    ^uint64_t(uint64_t configHash, NSString *file, TextLocation textLocation,
+              NSString *argumentString) {
+        NSString *shardPath = shard_path_from_path(file, sourceRoot);
+        // default config and files outside source root differ between checkouts
+        if (shardPath.absolutePath) {
+            shardPath = shardPath.lastPathComponent;
+        }
+        // config lines are single line so newline separates them
+        return fnv1a_string(configHash, [NSString stringWithFormat:@"%@:%lu %@\n",
+                                         shardPath ?: @"",
+                                         (unsigned long)textLocation.lineNumber,
+                                         argumentString ?: @""]);
+    };
+    for (AbstractMatch *matcher in self.matchers) {
+        hash = addConfig(hash, matcher.file, matcher.textLocation, matcher.argumentString);
+        for (AbstractAction *action in matcher.actions) {
+            hash = addConfig(hash, action.file, action.textLocation, action.argumentString);
+        }
+    }
+
+    return [NSString stringWithFormat:@"%016llx", (unsigned long long)hash];
+}
+
+// add what shards found as if matched by this linter
+- (void)addShardRuns {
+    NSString *sourceRoot = [self.linterSource sourceRoot];
+    NSString *fingerprint = [self configFingerprint];
+
+    for (NSDictionary *run in self.shardRuns) {
+        NSArray *matchCounts = run[@"matchCounts"];
+        if (![run[@"fingerprint"] isEqual:fingerprint] ||
+            matchCounts.count != self.matchers.count) {
+            [self.lintErrors addObject:
+             [LintError lintErrorWithFile:[self.linterSource projectPath]
+                                  message:@"Shard result was linted using a different configuration"]];
+            continue;
+        }
+
+        for (NSUInteger i = 0; i < matchCounts.count; i++) {
+            [self.matchers[i] addMatchCount:[matchCounts[i] unsignedIntegerValue]];
+        }
+
+        for (NSDictionary *reference in run[@"references"]) {
+            NSString *resourcePath = reference[@"resource"];
+            NSString *missingResourceHint = reference[@"missingHint"];
+            BOOL isNew = NO;
+            ResourceReference *resourceRef = [self.referenceGraph
+                                              addReferenceToResourcePath:resourcePath
+                                              referencePath:path_from_shard_path(reference[@"reference"],
+                                                                                 sourceRoot)
+                                              referenceLocation:text_location_from_shard_dictionary(reference)
+                                              referenceHint:reference[@"hint"]
+                                              missingResourceHint:^NSString *{
+                                                  return missingResourceHint;
+                                              }
+                                              isNew:&isNew];
+            // same as FileAction, a reference is linked to the bundle
+            // resource with the same path if there is one
+            BundleResource *bundleRes = self.bundleResources[resourcePath];
+            if (isNew && bundleRes != nil) {
+                [bundleRes.resourceReferences addObject:resourceRef];
+                [resourceRef.bundleResources addObject:bundleRes];
+            }
+        }
+
+        NSDictionary *bundleMatchers = run[@"bundleMatchers"];
+        for (NSString *bundlePath in bundleMatchers) {
+            BundleResource *bundleRes = self.bundleResources[bundlePath];
+            for (NSNumber *matcherIndex in bundleMatchers[bundlePath]) {
+                AbstractMatch *matcher = self.matchers[matcherIndex.unsignedIntegerValue];
+                if (bundleRes != nil && ![bundleRes.matchers containsObject:matcher]) {
+                    [bundleRes.matchers addObject:matcher];
+                }
+            }
+        }
+
+        for (NSDictionary *warning in run[@"lintWarnings"]) {
+            [self.lintWarnings addObject:
+             [LintWarning lintWarningWithFile:path_from_shard_path(warning[@"file"], sourceRoot)
+                                 textLocation:text_location_from_shard_dictionary(warning)
+                                      message:warning[@"message"]]];
+        }
+        for (NSDictionary *error in run[@"lintErrors"]) {
+            [self.lintErrors addObject:
+             [LintError lintErrorWithFile:path_from_shard_path(error[@"file"], sourceRoot)
+                                 location:text_location_from_shard_dictionary(error)
+                                  message:error[@"message"]]];
+        }
+    }
+}
+
 @end
@@ -17,13 +17,28 @@
 
 #import "ResourceLinter.h"
 
-@interface ResourceLinterAbstractReport : NSObject
+// report is written by writeReport when linting is done. set as delegate of
+// the linter to write issues known to be final while still linting
+@interface ResourceLinterAbstractReport : NSObject <ResourceLinterDelegate>
 @property(nonatomic, strong, readonly) ResourceLinter *linter;
+// lines are written to outputStream as they are added if set, otherwise
+// collected in outputBuffer
+@property(nonatomic, assign, readonly) FILE *outputStream;
 @property(nonatomic, strong, readonly) NSMutableString *outputBuffer;
+// issues written while linting, skipped by writeReport
+@property(nonatomic, strong, readonly) NSHashTable *writtenIssues;
 
 - (instancetype)init NS_UNAVAILABLE;
-- (instancetype)initWithLinter:(ResourceLinter *)linter NS_DESIGNATED_INITIALIZER;
+// linter is set when told about issues as delegate
+- (instancetype)initWithOutputStream:(FILE *)outputStream NS_DESIGNATED_INITIALIZER;
+- (instancetype)initWithLinter:(ResourceLinter *)linter
+                  outputStream:(FILE *)outputStream;
+- (instancetype)initWithLinter:(ResourceLinter *)linter;
+// subclasses write what has not been written while linting
+- (void)writeReport;
 - (void)addLine:(NSString *)format arguments:(va_list)va  NS_FORMAT_FUNCTION(1, 0);
 - (void)addLine:(NSString *)format, ... NS_FORMAT_FUNCTION(1, 2);
 - (void)addLines:(NSArray *)lines;
+// pass lines buffered by stdio on, used when writing while linting
+- (void)flush;
 @end
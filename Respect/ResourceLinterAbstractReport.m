@@ -19,28 +19,70 @@
 
 @interface ResourceLinterAbstractReport ()
 @property(nonatomic, strong, readwrite) ResourceLinter *linter;
+@property(nonatomic, assign, readwrite) FILE *outputStream;
 @property(nonatomic, strong, readwrite) NSMutableString *outputBuffer;
+@property(nonatomic, strong, readwrite) NSHashTable *writtenIssues;
 @end
 
 @implementation ResourceLinterAbstractReport
 
-- (instancetype)initWithLinter:(ResourceLinter *)linter {
+- (instancetype)initWithOutputStream:(FILE *)outputStream {
     self = [super init];
     if (self == nil) {
         return nil;
     }
 
-    self.linter = linter;
+    self.outputStream = outputStream;
     self.outputBuffer = [NSMutableString string];
+    // issues are compared by identity, same message can be reported twice
+    self.writtenIssues = [NSHashTable hashTableWithOptions:
+                          NSPointerFunctionsObjectPointerPersonality];
 
     return self;
 }
 
+- (instancetype)initWithLinter:(ResourceLinter *)linter
+                  outputStream:(FILE *)outputStream {
+    self = [self initWithOutputStream:outputStream];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.linter = linter;
+
+    return self;
+}
+
+- (instancetype)initWithLinter:(ResourceLinter *)linter {
+    return [self initWithLinter:linter outputStream:NULL];
+}
+
+- (void)resourceLinter:(ResourceLinter *)linter
+didFinishConfigWithConfigErrors:(NSArray *)configErrors
+            lintErrors:(NSArray *)lintErrors {
+    self.linter = linter;
+}
+
+- (void)resourceLinter:(ResourceLinter *)linter
+didMatchWithLintWarnings:(NSArray *)lintWarnings
+            lintErrors:(NSArray *)lintErrors {
+    self.linter = linter;
+}
+
+- (void)writeReport {
+}
 
 - (void)addLine:(NSString *)format arguments:(va_list)va {
-    [self.outputBuffer appendString:[[NSString alloc] initWithFormat:format
-                                                           arguments:va]];
-    [self.outputBuffer appendString:@"\n"];
+    NSString *line = [[NSString alloc] initWithFormat:format arguments:va];
+
+    if (self.outputStream != NULL) {
+        // stream is buffered by stdio, no need to collect whole report
+        fputs(line.UTF8String, self.outputStream);
+        fputc('\n', self.outputStream);
+    } else {
+        [self.outputBuffer appendString:line];
+        [self.outputBuffer appendString:@"\n"];
+    }
 }
 
 - (void)addLine:(NSString *)format, ... {
@@ -56,4 +98,10 @@
     }
 }
 
+- (void)flush {
+    if (self.outputStream != NULL) {
+        fflush(self.outputStream);
+    }
+}
+
 @end
@@ -21,16 +21,13 @@
 #import "ResourceReference.h"
 #import "BundleResource.h"
 #import "LintWarning.h"
+#import "BundleSizeStats.h"
 #import "NSString+Respect.h"
 
 @implementation ResourceLinterCliReport
 
-- (id)initWithLinter:(ResourceLinter *)linter {
-    self = [super initWithLinter:linter];
-    if (self == nil) {
-        return nil;
-    }
-
+// written when done so that each section is written once, in report order
+- (void)writeReport {
     [self addLine:
      @"Report for project %@ target %@ using build configuration %@",
      [self.linter.linterSource projectName],
@@ -110,7 +107,7 @@
      (self.linter.unusedResources).count,
      (self.linter.unusedResourcesIgnored).count];
     [self addLine:@"%ld references, %ld missing (%ld ignored)",
-     (self.linter.resourceReferences).count,
+     (self.linter.referenceGraph).count,
      (self.linter.missingReferences).count,
      (self.linter.missingReferencesIgnored).count];
     [self addLine:@"%ld errors (%ld ignored), %ld warnings (%ld ignored)",
@@ -118,7 +115,35 @@
      (self.linter.lintErrorsIgnored).count,
      (self.linter.lintWarnings).count,
      (self.linter.lintWarningsIgnored).count];
-    
-    return self;
+
+    BundleSizeStats *sizeStats = self.linter.bundleSizeStats;
+    if (sizeStats != nil) {
+        [self addLine:@"%llu bytes referenced, %llu unused (%llu ignored)",
+         sizeStats.total.referencedBytes,
+         sizeStats.total.unusedBytes,
+         sizeStats.total.unusedIgnoredBytes];
+
+        NSUInteger listed = 0;
+        for (BundleSizeStatsEntry *entry in sizeStats.directories) {
+            if (entry.unusedBytes == 0 || listed == 10) {
+                break;
+            }
+            if (listed++ == 0) {
+                [self addLine:@"Largest unused directories:"];
+            }
+            [self addLine:@"  %@: %llu bytes", entry.name, entry.unusedBytes];
+        }
+
+        listed = 0;
+        for (BundleSizeStatsEntry *entry in sizeStats.matchers) {
+            if (entry.referencedBytes == 0 || listed == 10) {
+                break;
+            }
+            if (listed++ == 0) {
+                [self addLine:@"Largest referencing matchers:"];
+            }
+            [self addLine:@"  %@: %llu bytes", entry.name, entry.referencedBytes];
+        }
+    }
 }
 @end
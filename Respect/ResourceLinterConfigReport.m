@@ -25,12 +25,7 @@
 
 @implementation ResourceLinterConfigReport
 
-- (id)initWithLinter:(ResourceLinter *)linter {
-    self = [super initWithLinter:linter];
-    if (self == nil) {
-        return nil;
-    }
-
+- (void)writeReport {
     [self addLine:
      @"// Interpreted config for %@ ",
      [self.linter.linterSource projectPath]];
@@ -86,8 +81,6 @@
             [self addLine:@""];
         }
     }
-    
-    return self;
 }
 
 @end
@@ -17,12 +17,18 @@
 
 #import "ResourceLinter.h"
 #import "PBXProject.h"
+#import "TextFileCache.h"
 
 @interface ResourceLinterXcodeProjectSource : NSObject <ResourceLinterSource>
 - (instancetype)init NS_UNAVAILABLE;
+// textFileCache can be shared between sources for several targets
 - (instancetype)initWithPBXProject:(PBXProject *)pbxProject
                       nativeTarget:(PBXNativeTarget *)nativeTarget
-                buildConfiguration:(XCBuildConfiguration *)buildConfiguration NS_DESIGNATED_INITIALIZER;
+                buildConfiguration:(XCBuildConfiguration *)buildConfiguration
+                     textFileCache:(TextFileCache *)textFileCache NS_DESIGNATED_INITIALIZER;
+- (instancetype)initWithPBXProject:(PBXProject *)pbxProject
+                      nativeTarget:(PBXNativeTarget *)nativeTarget
+                buildConfiguration:(XCBuildConfiguration *)buildConfiguration;
 
 - (void)addSpotifyFeaturesAtPath:(NSString *)featuresPath;
 @end
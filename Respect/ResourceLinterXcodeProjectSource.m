@@ -17,32 +17,41 @@
 
 #import "ResourceLinterXcodeProjectSource.h"
 #import "TextFile.h"
+#import "ConfigLine.h"
 #import "LintError.h"
 #import "LintWarning.h"
 #import "NSString+Respect.h"
-#import "NSString+PBXProject.h"
 #import "NSArray+Respect.h"
+#import "FileMetadataTable.h"
+#import "IncludeScanner.h"
+#import "ScratchArena.h"
 
 
 @interface ResourceLinterXcodeProjectSource ()
 @property(nonatomic, strong, readwrite) PBXProject *pbxProject;
 @property(nonatomic, strong, readwrite) PBXNativeTarget *nativeTarget;
 @property(nonatomic, strong, readwrite) XCBuildConfiguration *buildConfiguration;
+@property(nonatomic, strong, readwrite) TextFileCache *textFileCache;
 @property(nonatomic, strong, readwrite) NSMutableDictionary *sourceTextFiles;
 @property(nonatomic, strong, readwrite) NSMutableDictionary *resources;
 @property(nonatomic, strong, readwrite) NSMutableArray *lintWarnings;
 @property(nonatomic, strong, readwrite) NSMutableArray *lintErrors;
+@property(nonatomic, strong, readwrite) FileMetadataTable *fileMetadataTable;
 
 - (void)parseAndAddImportAndIncludesInTextFile:(TextFile *)textFile
                              headerSearchPaths:(NSArray *)headerSearchPaths;
 
 @end
 
-@implementation ResourceLinterXcodeProjectSource
+@implementation ResourceLinterXcodeProjectSource {
+    // text and #if stack of include scanning, reset after each source file
+    ScratchArena *_scratchArena;
+}
 
 - (id)initWithPBXProject:(PBXProject *)pbxProject
             nativeTarget:(PBXNativeTarget *)nativeTarget
-      buildConfiguration:(XCBuildConfiguration *)buildConfiguration {
+      buildConfiguration:(XCBuildConfiguration *)buildConfiguration
+           textFileCache:(TextFileCache *)textFileCache {
     self = [super init];
     if (self == nil) {
         return nil;
@@ -51,10 +60,13 @@
     self.pbxProject = pbxProject;
     self.nativeTarget = nativeTarget;
     self.buildConfiguration = buildConfiguration;
+    self.textFileCache = textFileCache;
     self.sourceTextFiles = [NSMutableDictionary dictionary];
     self.resources = [NSMutableDictionary dictionary];
     self.lintWarnings = [NSMutableArray array];
     self.lintErrors = [NSMutableArray array];
+    self.fileMetadataTable = [[FileMetadataTable alloc] init];
+    _scratchArena = ScratchArenaCreate(64 * 1024);
 
     NSArray *headerSearchPaths = [self.buildConfiguration
                                   resolveConfigPathsNamed:@"HEADER_SEARCH_PATHS"
@@ -66,7 +78,7 @@
     if (precompiledHeaderPath != nil) {
         NSString *absPrecompiledHeaderPath = [[self sourceRoot]
                                               stringByAppendingPathComponent:precompiledHeaderPath];
-        TextFile *headerTextFile = [TextFile textFileWithContentOfFile:absPrecompiledHeaderPath];
+        TextFile *headerTextFile = [self.textFileCache textFileWithContentOfFile:absPrecompiledHeaderPath];
         if (headerTextFile != nil) {
             self.sourceTextFiles[absPrecompiledHeaderPath] = headerTextFile;
         } else {
@@ -86,6 +98,8 @@
         self.resources[@"Info.plist"] = absInfoPlistBuildPath;
     }
 
+    [self prefetchFileMetadataForBuildPhases:self.nativeTarget.buildPhases];
+
     for (id buildPhase in self.nativeTarget.buildPhases) {
         // TODO: copy phase?
 
@@ -100,41 +114,86 @@
     return self;
 }
 
+- (id)initWithPBXProject:(PBXProject *)pbxProject
+            nativeTarget:(PBXNativeTarget *)nativeTarget
+      buildConfiguration:(XCBuildConfiguration *)buildConfiguration {
+    return [self initWithPBXProject:pbxProject
+                       nativeTarget:nativeTarget
+                 buildConfiguration:buildConfiguration
+                      textFileCache:[[TextFileCache alloc] init]];
+}
 
-- (void)addSourcesBuildPhase:(PBXSourcesBuildPhase *)sourcesBuildPhase
-           headerSearchPaths:(NSArray *)headerSearchPaths {
-    for (PBXBuildFile *buildFile in sourcesBuildPhase.files) {
-        NSString *buildPath = [buildFile.fileRef buildPath];
-        if (buildPath == nil) {
-            [self.lintErrors addObject:
-             [LintError lintErrorWithFile:buildPath
-                                  message:[NSString stringWithFormat:
-                                           @"Failed to resolve path (souceTree=%@ path=%@)",
-                                           buildFile.fileRef.sourceTree,
-                                           buildFile.fileRef.path]]];
-            continue;
-        }
+- (void)dealloc {
+    ScratchArenaDestroy(_scratchArena);
+}
 
-        // A build file can have a file ref that points to a directoary and
-        // not a source file (e.g. wrapper.xcmappingmodel). Just ignore if so.
-        BOOL isDir = NO;
-        if ([[NSFileManager defaultManager] fileExistsAtPath:buildPath
-                                                 isDirectory:&isDir] &&
-            isDir) {
+// resolve and stat all source and resource build paths concurrently up front
+// instead of one blocking stat at a time while adding the build phases
+- (void)prefetchFileMetadataForBuildPhases:(NSArray *)buildPhases {
+    NSMutableArray *buildPaths = [NSMutableArray array];
+
+    for (id buildPhase in buildPhases) {
+        if (!([buildPhase isKindOfClass:[PBXSourcesBuildPhase class]] ||
+              [buildPhase isKindOfClass:[PBXResourcesBuildPhase class]])) {
             continue;
         }
 
-        TextFile *sourceTextFile = [TextFile textFileWithContentOfFile:buildPath];
-        if (sourceTextFile == nil) {
-            [self.lintErrors addObject:
-             [LintError lintErrorWithFile:buildPath
-                                  message:@"Failed to read source file"]];
-            continue;
+        for (PBXBuildFile *buildFile in ((PBXBuildPhase *)buildPhase).files) {
+            NSArray *nodes = nil;
+            if ([buildFile.fileRef isKindOfClass:[PBXVariantGroup class]]) {
+                nodes = ((PBXVariantGroup *)buildFile.fileRef).children;
+            } else if (buildFile.fileRef != nil) {
+                nodes = @[buildFile.fileRef];
+            }
+
+            for (PBXNode *node in nodes) {
+                NSString *buildPath = [node buildPath];
+                if (buildPath != nil) {
+                    [buildPaths addObject:buildPath];
+                }
+            }
         }
+    }
+
+    [self.fileMetadataTable prefetchPaths:buildPaths];
+}
+
+- (void)addSourcesBuildPhase:(PBXSourcesBuildPhase *)sourcesBuildPhase
+           headerSearchPaths:(NSArray *)headerSearchPaths {
+    for (PBXBuildFile *buildFile in sourcesBuildPhase.files) {
+        // drop per file temporaries before next file
+        @autoreleasepool {
+            NSString *buildPath = [buildFile.fileRef buildPath];
+            if (buildPath == nil) {
+                [self.lintErrors addObject:
+                 [LintError lintErrorWithFile:buildPath
+                                      message:[NSString stringWithFormat:
+                                               @"Failed to resolve path (souceTree=%@ path=%@)",
+                                               buildFile.fileRef.sourceTree,
+                                               buildFile.fileRef.path]]];
+                continue;
+            }
 
-        self.sourceTextFiles[buildPath] = sourceTextFile;
-        [self parseAndAddImportAndIncludesInTextFile:sourceTextFile
-                                   headerSearchPaths:headerSearchPaths];
+            // A build file can have a file ref that points to a directoary and
+            // not a source file (e.g. wrapper.xcmappingmodel). Just ignore if so.
+            BOOL isDir = NO;
+            if ([self.fileMetadataTable fileExistsAtPath:buildPath isDirectory:&isDir] &&
+                isDir) {
+                continue;
+            }
+
+            TextFile *sourceTextFile = [self.textFileCache textFileWithContentOfFile:buildPath];
+            if (sourceTextFile == nil) {
+                [self.lintErrors addObject:
+                 [LintError lintErrorWithFile:buildPath
+                                      message:@"Failed to read source file"]];
+                continue;
+            }
+
+            self.sourceTextFiles[buildPath] = sourceTextFile;
+            [self parseAndAddImportAndIncludesInTextFile:sourceTextFile
+                                       headerSearchPaths:headerSearchPaths];
+        }
     }
 }
 
@@ -159,7 +218,10 @@
             NSString *bundlePath = fileRef.name ?: fileRef.path;
             NSString *buildPath = [fileRef buildPath];
 
-            if ([fileRef isFolderReference]) {
+            // same as [fileRef isFolderReference] but using prefetched metadata
+            BOOL isDir = NO;
+            if ([self.fileMetadataTable fileExistsAtPath:buildPath isDirectory:&isDir] &&
+                isDir) {
                 NSMutableDictionary *folderResources = [NSMutableDictionary dictionary];
                 NSArray *folderSubPahts = [fileRef subPathsForFolderReference];
 
@@ -176,7 +238,7 @@
                 buildResources = folderResources;
 
             } else {
-                if (![[NSFileManager defaultManager] isReadableFileAtPath:buildPath]) {
+                if (![self.fileMetadataTable isReadableFileAtPath:buildPath]) {
                     [self.lintErrors addObject:
                      [LintError lintErrorWithFile:buildPath
                                           message:@"Failed to open file or folder reference"]];
@@ -272,47 +334,29 @@
     return @"";
 }
 
-+ (NSString *)IOSDefultConfigString {
-    // auto generated by run script from IOSDefault.config
-#include "IOSDefault.config.generated.c"
-
-    return [[NSString alloc] initWithBytes:IOSDefault_config
-                                    length:IOSDefault_config_len
-                                  encoding:NSUTF8StringEncoding];
-}
-
-- (TextFile *)defaultConfigTextFile {
+- (NSArray *)defaultConfigLines {
     if ([self targetType] == ResourceLinterSourceTargetTypeIOS) {
-        return [TextFile
-                textFileWithText:
-                [[[self class] IOSDefultConfigString]
-                 pbx_stringByReplacingVariablesFromDict:
-                 @{@"DEVICES_RE": [[NSArray respect_arrayWithIOSImageDeviceNames]
-                                   componentsJoinedByString:@"|"],
-                   @"EXTS_RE": [[NSArray respect_arrayWithIOSImageExtensionNames]
-                                componentsJoinedByString:@"|"]}]
-                path:@"IOSDefault.config"];
+        // auto generated by run script from IOSDefault.config
+#include "IOSDefault.config.table.generated.c"
+
+        return [ConfigLine
+                configLinesFromEntries:IOSDefault_config_table
+                count:IOSDefault_config_table_len
+                file:@"IOSDefault.config"
+                variables:
+                @{@"DEVICES_RE": [[NSArray respect_arrayWithIOSImageDeviceNames]
+                                  componentsJoinedByString:@"|"],
+                  @"EXTS_RE": [[NSArray respect_arrayWithIOSImageExtensionNames]
+                               componentsJoinedByString:@"|"]}];
     } else {
         // TODO: OS X project etc
-        return [TextFile textFileWithText:@"" path:@""];
+        return @[];
     }
 }
 
 - (void)_parseAndAddImportAndIncludesInTextFile:(TextFile *)textFile
                               headerSearchPaths:(NSArray *)headerSearchPaths
                                        maxDepth:(NSUInteger)maxDepth {
-    static NSRegularExpression *re = nil;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        re = [[NSRegularExpression alloc]
-              initWithPattern:
-              // match #include "..." or #import "..."
-              // capture group 1 is filename
-              @"#\\s*(?:import|include)\\s*\"([^\"]*)\""
-              options:0
-              error:NULL];
-    });
-
     // TODO: maxDepth limit needed?
     if (maxDepth == 0) {
         return;
@@ -320,56 +364,64 @@
 
     NSString *pathDir = (textFile.path).stringByDeletingLastPathComponent;
 
-    [re enumerateMatchesInString:textFile.text
-                         options:0
-                           range:NSMakeRange(0, (textFile.text).length)
-                      usingBlock:
-     ^(NSTextCheckingResult *result, NSMatchingFlags flags, BOOL *stop) {
-         NSString *includePath = [textFile.text substringWithRange:[result rangeAtIndex:1]];
-
-         NSString *absIncludePath = [includePath respect_stringByResolvingPathRealtiveTo:pathDir];
-         // skip if already added
-         if (self.sourceTextFiles[absIncludePath]) {
-             return;
-         }
-
-         TextFile *includeTextFile = [TextFile textFileWithContentOfFile:absIncludePath];
-         if (includeTextFile == nil) {
-             // TODO: refactor code. but keep in mind that we might dont want to
-             // refactor by building a an array with all search paths for each iteration
-             for (NSString *headerSearchPath in headerSearchPaths) {
-                 absIncludePath = [includePath respect_stringByResolvingPathRealtiveTo:headerSearchPath];
-
-                 // already added
-                 if (self.sourceTextFiles[absIncludePath]) {
-                     return;
-                 }
-
-                 includeTextFile = [TextFile textFileWithContentOfFile:absIncludePath];
-                 if (includeTextFile != nil) {
-                     break;
-                 }
-             }
-         }
-
-         if (includeTextFile == nil) {
-             // ignore include errors for now
-             /*
-              [self.lintErrors addObject:
-              [LintError lintErrorWithFile:absImportPath
-              message:[NSString stringWithFormat:
-              @"Failed to read source file (included from %@)",
-              [textFile.path stringRelativeToPathPrefix:
-              [self sourceRoot]]]]];
-              */
-             return;
-         }
-
-         self.sourceTextFiles[absIncludePath] = includeTextFile;
-         [self _parseAndAddImportAndIncludesInTextFile:includeTextFile
-                                     headerSearchPaths:headerSearchPaths
-                                              maxDepth:maxDepth-1];
-     }];
+    // only #import "..." and #include "..." directives that are not commented
+    // out or in #if 0 blocks
+    NSArray *includePaths = [IncludeScanner quotedIncludePathsInText:textFile.text
+                                                         honorDefines:YES
+                                                         scratchArena:_scratchArena];
+    // paths are copied out, reuse the arena for the next file so it stays at
+    // one file's worth instead of the whole include tree
+    ScratchArenaReset(_scratchArena);
+    for (NSString *includePath in includePaths) {
+        NSString *absIncludePath = [includePath respect_stringByResolvingPathRealtiveTo:pathDir];
+        // skip if already added
+        if (self.sourceTextFiles[absIncludePath]) {
+            continue;
+        }
+
+        TextFile *includeTextFile = [self.textFileCache textFileWithContentOfFile:absIncludePath];
+        if (includeTextFile == nil) {
+            // TODO: refactor code. but keep in mind that we might dont want to
+            // refactor by building a an array with all search paths for each iteration
+            BOOL alreadyAdded = NO;
+            for (NSString *headerSearchPath in headerSearchPaths) {
+                absIncludePath = [includePath respect_stringByResolvingPathRealtiveTo:headerSearchPath];
+
+                // already added
+                if (self.sourceTextFiles[absIncludePath]) {
+                    alreadyAdded = YES;
+                    break;
+                }
+
+                includeTextFile = [self.textFileCache textFileWithContentOfFile:absIncludePath];
+                if (includeTextFile != nil) {
+                    break;
+                }
+            }
+
+            if (alreadyAdded) {
+                continue;
+            }
+        }
+
+        if (includeTextFile == nil) {
+            // ignore include errors for now
+            /*
+             [self.lintErrors addObject:
+             [LintError lintErrorWithFile:absImportPath
+             message:[NSString stringWithFormat:
+             @"Failed to read source file (included from %@)",
+             [textFile.path stringRelativeToPathPrefix:
+             [self sourceRoot]]]]];
+             */
+            continue;
+        }
+
+        self.sourceTextFiles[absIncludePath] = includeTextFile;
+        [self _parseAndAddImportAndIncludesInTextFile:includeTextFile
+                                    headerSearchPaths:headerSearchPaths
+                                             maxDepth:maxDepth-1];
+    }
 }
 
 - (void)parseAndAddImportAndIncludesInTextFile:(TextFile *)textFile
@@ -430,7 +482,7 @@
     if (precompiledHeaderPath != nil) {
         NSString *absPrecompiledHeaderPath = [[featurePbxProject sourceRoot]
                                               stringByAppendingPathComponent:precompiledHeaderPath];
-        TextFile *headerTextFile = [TextFile textFileWithContentOfFile:absPrecompiledHeaderPath];
+        TextFile *headerTextFile = [self.textFileCache textFileWithContentOfFile:absPrecompiledHeaderPath];
         if (headerTextFile != nil) {
             self.sourceTextFiles[absPrecompiledHeaderPath] = headerTextFile;
         } else {
@@ -441,6 +493,8 @@
         }
     }
 
+    [self prefetchFileMetadataForBuildPhases:featureNativeTarget.buildPhases];
+
     for (id buildPhase in featureNativeTarget.buildPhases) {
         if ([buildPhase isKindOfClass:[PBXSourcesBuildPhase class]]) {
             [self addSourcesBuildPhase:buildPhase
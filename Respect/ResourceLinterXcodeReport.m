@@ -21,15 +21,13 @@
 #import "ResourceReference.h"
 #import "BundleResource.h"
 #import "LintWarning.h"
-
-static NSComparator pathStringComparator = ^NSComparisonResult(id a, id b) {
-    return [a compare:b options:NSCaseInsensitiveSearch|NSNumericSearch];
-};
+#import "NSString+Respect.h"
 
 @interface ResourceLinterXcodeReport ()
 @property(nonatomic, strong, readwrite) NSMutableDictionary *fileIssues;
 
 - (void)addIssue:(id)issue forFile:(NSString *)file;
+- (void)writeIssue:(id)issue;
 - (void)addXcodeWarning:(NSString *)file
            textLocation:(TextLocation)textLocation
                  format:(NSString *)format, ... NS_FORMAT_FUNCTION(3, 4);
@@ -37,86 +35,110 @@ static NSComparator pathStringComparator = ^NSComparisonResult(id a, id b) {
 
 @implementation ResourceLinterXcodeReport
 
-- (id)initWithLinter:(ResourceLinter *)linter {
-    self = [super initWithLinter:linter];
-    if (self == nil) {
-        return nil;
+// config errors are written as soon as config has been read so they show up
+// in Xcode while the target is still being linted
+- (void)resourceLinter:(ResourceLinter *)linter
+didFinishConfigWithConfigErrors:(NSArray *)configErrors
+            lintErrors:(NSArray *)lintErrors {
+    [super resourceLinter:linter
+didFinishConfigWithConfigErrors:configErrors
+               lintErrors:lintErrors];
+
+    for (NSArray *issues in @[lintErrors, configErrors]) {
+        for (id issue in issues) {
+            [self writeIssue:issue];
+            [self.writtenIssues addObject:issue];
+        }
     }
+    [self flush];
+}
 
+- (void)writeReport {
     // Xcode run script warning/error messages seems to need to be
     // grouped per file to work properly so collect issues per file.
 
     self.fileIssues = [NSMutableDictionary dictionary];
 
-    for (LintError *lintError in linter.lintErrors) {
+    for (LintError *lintError in self.linter.lintErrors) {
         [self addIssue:lintError forFile:lintError.file];
     }
 
-    for (ConfigError *configError in linter.configErrors) {
+    for (ConfigError *configError in self.linter.configErrors) {
         [self addIssue:configError forFile:configError.file];
     }
 
-    for (ResourceReference *resourceRef in linter.missingReferences) {
+    for (ResourceReference *resourceRef in self.linter.missingReferences) {
         [self addIssue:resourceRef forFile:resourceRef.resourcePath];
     }
 
-    for (BundleResource *bundleRes in linter.unusedResources) {
+    for (BundleResource *bundleRes in self.linter.unusedResources) {
         [self addIssue:bundleRes forFile:bundleRes.buildSourcePath];
     }
 
-    for (LintWarning *lintWarning in linter.lintWarnings) {
+    for (LintWarning *lintWarning in self.linter.lintWarnings) {
         [self addIssue:lintWarning forFile:lintWarning.file];
     }
 
-    for (NSString *file in [(self.fileIssues).allKeys
-                            sortedArrayUsingComparator:pathStringComparator]) {
+    // compute sort key once per file instead of per comparison
+    NSMutableDictionary *fileSortKeys = [NSMutableDictionary dictionary];
+    for (NSString *file in self.fileIssues) {
+        fileSortKeys[file] = [file respect_sortKey] ?: [NSNull null];
+    }
+    NSArray *sortedFiles = [(self.fileIssues).allKeys
+                            sortedArrayWithOptions:NSSortConcurrent|NSSortStable
+                            usingComparator:^NSComparisonResult(id a, id b) {
+                                id aKey = fileSortKeys[a];
+                                id bKey = fileSortKeys[b];
+                                return RespectCompareUsingSortKeys(
+                                    a, aKey == [NSNull null] ? nil : aKey,
+                                    b, bKey == [NSNull null] ? nil : bKey);
+                            }];
+
+    for (NSString *file in sortedFiles) {
         for (id issue in self.fileIssues[file]) {
-            if ([issue isKindOfClass:[ResourceReference class]]) {
-                ResourceReference *resourceRef = issue;
-
-                [self addXcodeWarning:resourceRef.referencePath
-                         textLocation:resourceRef.referenceLocation
-                               format:
-                 @"Missing resource \"%@\"%@%@",
-                 resourceRef.resourcePath,
-                 resourceRef.missingResourceHint == nil ? @"" :
-                 [NSString stringWithFormat:@", did you mean \"%@\"?",
-                  resourceRef.missingResourceHint],
-                 resourceRef.referenceHint == nil ? @"" :
-                 [NSString stringWithFormat:@" (%@)", resourceRef.referenceHint]];
-            } else if ([issue isKindOfClass:[BundleResource class]]) {
-                BundleResource *bundleRes = issue;
-                [self addXcodeWarning:bundleRes.buildSourcePath
-                         textLocation:MakeTextLineLocation(1)
-                               format:
-                 @"Unused resource \"%@\"",
-                 bundleRes.path];
-            } else if ([issue isKindOfClass:[LintWarning class]]) {
-                LintWarning *lintWarning = issue;
-                [self addXcodeWarning:lintWarning.file
-                         textLocation:lintWarning.textLocation
-                               format:@"%@", lintWarning.message];
-            } else if ([issue isKindOfClass:[ConfigError class]]) {
-                ConfigError *configError = issue;
-                [self addXcodeWarning:configError.file
-                         textLocation:configError.textLocation
-                               format:@"%@", configError.message];
-            } else if ([issue isKindOfClass:[LintError class]]) {
-                LintError *lintError = issue;
-                [self addXcodeWarning:lintError.file
-                         textLocation:lintError.textLocation
-                               format:@"%@", lintError.message];
-            } else {
-                NSAssert(0, @"");
-            }
+            [self writeIssue:issue];
         }
     }
+}
 
-    return self;
+- (void)writeIssue:(id)issue {
+    if ([issue isKindOfClass:[ResourceReference class]]) {
+        ResourceReference *resourceRef = issue;
+
+        [self addXcodeWarning:resourceRef.referencePath
+                 textLocation:resourceRef.referenceLocation
+                       format:@"%@", [resourceRef missingResourceMessage]];
+    } else if ([issue isKindOfClass:[BundleResource class]]) {
+        BundleResource *bundleRes = issue;
+        [self addXcodeWarning:bundleRes.buildSourcePath
+                 textLocation:MakeTextLineLocation(1)
+                       format:@"%@", [bundleRes unusedResourceMessage]];
+    } else if ([issue isKindOfClass:[LintWarning class]]) {
+        LintWarning *lintWarning = issue;
+        [self addXcodeWarning:lintWarning.file
+                 textLocation:lintWarning.textLocation
+                       format:@"%@", lintWarning.message];
+    } else if ([issue isKindOfClass:[ConfigError class]]) {
+        ConfigError *configError = issue;
+        [self addXcodeWarning:configError.file
+                 textLocation:configError.textLocation
+                       format:@"%@", configError.message];
+    } else if ([issue isKindOfClass:[LintError class]]) {
+        LintError *lintError = issue;
+        [self addXcodeWarning:lintError.file
+                 textLocation:lintError.textLocation
+                       format:@"%@", lintError.message];
+    } else {
+        NSAssert(0, @"");
+    }
 }
 
 
 - (void)addIssue:(id)issue forFile:(NSString *)file {
+    if ([self.writtenIssues containsObject:issue]) {
+        return;
+    }
+
     NSMutableArray *issues = self.fileIssues[file];
     if (issues == nil) {
         issues = [NSMutableArray array];
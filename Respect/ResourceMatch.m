@@ -88,36 +88,40 @@
         return;
     }
     
+    PerformParameters *performParameters = [[PerformParameters alloc] init];
+    NSRange *ranges = calloc(self.re.numberOfCaptureGroups + 1, sizeof(NSRange));
+
     for (BundleResource *bundleRes in [self.linter.bundleResources objectEnumerator]) {
-        NSTextCheckingResult *result = [self.re
-                                        firstMatchInString:bundleRes.path
-                                        options:0
-                                        range:NSMakeRange(0, (bundleRes.path).length)];
-        if (result == nil || result.range.location == NSNotFound) {
+        if (![self.linter shardContainsPath:bundleRes.path]) {
             continue;
         }
-        
-        NSMutableArray *parameters = [NSMutableArray array];
-        for (NSUInteger i = 0; i < result.numberOfRanges; i++) {
-            if ([result rangeAtIndex:i].location == NSNotFound) {
-                [parameters addObject:@""];
-            } else {
-                [parameters addObject:[bundleRes.path substringWithRange:[result rangeAtIndex:i]]];
+
+        // match result and action temporaries of each resource
+        @autoreleasepool {
+            NSTextCheckingResult *result = [self.re
+                                            firstMatchInString:bundleRes.path
+                                            options:0
+                                            range:NSMakeRange(0, (bundleRes.path).length)];
+            if (result == nil || result.range.location == NSNotFound) {
+                continue;
             }
-        }
         
-        PerformParameters *performParameters = [PerformParameters
-                                                performParametersWithParameters:parameters
-                                                path:bundleRes.buildSourcePath
-                                                textLocation:MakeTextLineLocation(0)];
-        [self.performParameters addObject:performParameters];
+            for (NSUInteger i = 0; i < result.numberOfRanges; i++) {
+                ranges[i] = [result rangeAtIndex:i];
+            }
         
-        for (AbstractAction *action in self.actions) {
-            [action performWithParameters:performParameters];
+            [performParameters resetWithText:bundleRes.path
+                                       ranges:ranges
+                                        count:result.numberOfRanges
+                                     unescape:NO
+                                         path:bundleRes.buildSourcePath
+                                 textLocation:MakeTextLineLocation(0)];
+            [self performActionsWithParameters:performParameters];
         }
     }
+    free(ranges);
     
-    if (!self.isDefaultConfig && (self.performParameters).count == 0) {
+    if (!self.isDefaultConfig && self.matchCount == 0) {
         [self.linter.configErrors addObject:
          [ConfigError configErrorWithFile:self.file
                              textLocation:self.textLocation
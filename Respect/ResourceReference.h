@@ -17,10 +17,17 @@
 
 #import "BundleResource.h"
 #import "TextLocation.h"
+#import "PathTable.h"
 
 @interface ResourceReference : NSObject
 @property(nonatomic, copy, readonly) NSString *resourcePath;
 @property(nonatomic, copy, readonly) NSString *referencePath;
+// ids in the linter PathTable, paths above are the interned strings
+@property(nonatomic, assign, readonly) NSUInteger resourcePathID;
+@property(nonatomic, assign, readonly) NSUInteger referencePathID;
+// shared per path, used for report ordering
+@property(nonatomic, strong, readonly) NSData *resourcePathSortKey;
+@property(nonatomic, strong, readonly) NSData *referencePathSortKey;
 @property(nonatomic, assign, readonly) TextLocation referenceLocation;
 @property(nonatomic, copy, readonly) NSString *referenceHint;
 @property(nonatomic, strong, readonly) NSMutableArray *bundleResources;
@@ -31,9 +38,14 @@
                        referencePath:(NSString *)referencePath
                    referenceLocation:(TextLocation)referenceLocation
                        referenceHint:(NSString *)referenceHint
-                 missingResourceHint:(NSString *)missingResourceHint NS_DESIGNATED_INITIALIZER;
+                 missingResourceHint:(NSString *)missingResourceHint
+                           pathTable:(PathTable *)pathTable NS_DESIGNATED_INITIALIZER;
 - (instancetype)initWithResourcePath:(NSString *)resourcePath
                        referencePath:(NSString *)referencePath
                    referenceLocation:(TextLocation)referenceLocation
-                 missingResourceHint:(NSString *)missingResourceHint;
+                 missingResourceHint:(NSString *)missingResourceHint
+                           pathTable:(PathTable *)pathTable;
+
+// message used by reports, "Missing resource ..." with hints
+- (NSString *)missingResourceMessage;
 @end
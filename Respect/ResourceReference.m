@@ -22,6 +22,10 @@
 @interface ResourceReference ()
 @property(nonatomic, copy, readwrite) NSString *resourcePath;
 @property(nonatomic, copy, readwrite) NSString *referencePath;
+@property(nonatomic, assign, readwrite) NSUInteger resourcePathID;
+@property(nonatomic, assign, readwrite) NSUInteger referencePathID;
+@property(nonatomic, strong, readwrite) NSData *resourcePathSortKey;
+@property(nonatomic, strong, readwrite) NSData *referencePathSortKey;
 @property(nonatomic, assign, readwrite) TextLocation referenceLocation;
 @property(nonatomic, copy, readwrite) NSString *referenceHint;
 @property(nonatomic, strong, readwrite) NSMutableArray *bundleResources;
@@ -34,14 +38,19 @@
                        referencePath:(NSString *)referencePath
                    referenceLocation:(TextLocation)referenceLocation
                        referenceHint:(NSString *)referenceHint
-                 missingResourceHint:(NSString *)missingResourceHint {
+                 missingResourceHint:(NSString *)missingResourceHint
+                           pathTable:(PathTable *)pathTable {
     self = [super init];
     if (self == nil) {
         return nil;
     }
 
-    self.resourcePath = resourcePath;
-    self.referencePath = referencePath;
+    self.resourcePathID = [pathTable pathIDForPath:resourcePath];
+    self.referencePathID = [pathTable pathIDForPath:referencePath];
+    self.resourcePath = [pathTable pathForPathID:self.resourcePathID];
+    self.referencePath = [pathTable pathForPathID:self.referencePathID];
+    self.resourcePathSortKey = [pathTable sortKeyForPathID:self.resourcePathID];
+    self.referencePathSortKey = [pathTable sortKeyForPathID:self.referencePathID];
     self.referenceHint = referenceHint;
     self.referenceLocation = referenceLocation;
     self.bundleResources = [NSMutableArray array];
@@ -53,13 +62,25 @@
 - (instancetype)initWithResourcePath:(NSString *)resourcePath
                        referencePath:(NSString *)referencePath
                    referenceLocation:(TextLocation)referenceLocation
-                 missingResourceHint:(NSString *)missingResourceHint {
+                 missingResourceHint:(NSString *)missingResourceHint
+                           pathTable:(PathTable *)pathTable {
     return [self initWithResourcePath:resourcePath
                         referencePath:referencePath
                     referenceLocation:referenceLocation
                         referenceHint:nil
-                  missingResourceHint:missingResourceHint];
+                  missingResourceHint:missingResourceHint
+                            pathTable:pathTable];
 }
 
+- (NSString *)missingResourceMessage {
+    return [NSString stringWithFormat:
+            @"Missing resource \"%@\"%@%@",
+            self.resourcePath,
+            self.missingResourceHint == nil ? @"" :
+            [NSString stringWithFormat:@", did you mean \"%@\"?",
+             self.missingResourceHint],
+            self.referenceHint == nil ? @"" :
+            [NSString stringWithFormat:@" (%@)", self.referenceHint]];
+}
 
 @end
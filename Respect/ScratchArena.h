@@ -0,0 +1,38 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Bump allocator for short lived C buffers used while scanning one file.
+ * Allocations are never freed one by one, instead the whole arena is reset
+ * when done with a file and the memory is reused for the next one.
+ */
+
+#import <Foundation/Foundation.h>
+
+typedef struct ScratchArena ScratchArena;
+
+// blockSize is the size of the first block, larger ones are added as needed
+ScratchArena *ScratchArenaCreate(size_t blockSize);
+void ScratchArenaDestroy(ScratchArena *arena);
+// 16 byte aligned memory valid until reset or destroy
+void *ScratchArenaAlloc(ScratchArena *arena, size_t size);
+// grow an allocation, extends in place if it was the last one
+void *ScratchArenaRealloc(ScratchArena *arena, void *ptr, size_t oldSize, size_t newSize);
+// make all memory available again. keeps the largest block so that a
+// following file of similar size does not allocate
+void ScratchArenaReset(ScratchArena *arena);
+// bytes allocated since last reset
+size_t ScratchArenaUsedBytes(ScratchArena *arena);
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ScratchArena.h"
+
+typedef struct ScratchArenaBlock {
+    struct ScratchArenaBlock *next;
+    size_t size;
+    size_t used;
+    // keeps data after header 16 byte aligned
+    size_t padding;
+} ScratchArenaBlock;
+
+struct ScratchArena {
+    // current block first
+    ScratchArenaBlock *blocks;
+    size_t blockSize;
+    size_t usedBytes;
+};
+
+static const size_t kAlignment = 16;
+
+static size_t align_size(size_t size) {
+    return (MAX(size, 1) + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+static char *block_data(ScratchArenaBlock *block) {
+    return (char *)(block + 1);
+}
+
+ScratchArena *ScratchArenaCreate(size_t blockSize) {
+    ScratchArena *arena = calloc(1, sizeof(ScratchArena));
+    arena->blockSize = align_size(blockSize);
+
+    return arena;
+}
+
+void ScratchArenaDestroy(ScratchArena *arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    ScratchArenaBlock *block = arena->blocks;
+    while (block != NULL) {
+        ScratchArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
+void *ScratchArenaAlloc(ScratchArena *arena, size_t size) {
+    size_t aligned = align_size(size);
+    ScratchArenaBlock *block = arena->blocks;
+
+    if (block == NULL || block->size - block->used < aligned) {
+        // double so that a large file needs few blocks
+        size_t blockSize = MAX(arena->blockSize, aligned);
+        if (block != NULL) {
+            blockSize = MAX(blockSize, block->size * 2);
+        }
+        block = malloc(sizeof(ScratchArenaBlock) + blockSize);
+        block->next = arena->blocks;
+        block->size = blockSize;
+        block->used = 0;
+        arena->blocks = block;
+    }
+
+    void *ptr = block_data(block) + block->used;
+    block->used += aligned;
+    arena->usedBytes += aligned;
+
+    return ptr;
+}
+
+void *ScratchArenaRealloc(ScratchArena *arena, void *ptr, size_t oldSize, size_t newSize) {
+    if (ptr == NULL) {
+        return ScratchArenaAlloc(arena, newSize);
+    }
+    if (newSize <= oldSize) {
+        return ptr;
+    }
+
+    size_t oldAligned = align_size(oldSize);
+    size_t newAligned = align_size(newSize);
+    ScratchArenaBlock *block = arena->blocks;
+    if ((char *)ptr + oldAligned == block_data(block) + block->used &&
+        block->size - block->used >= newAligned - oldAligned) {
+        block->used += newAligned - oldAligned;
+        arena->usedBytes += newAligned - oldAligned;
+        return ptr;
+    }
+
+    void *newPtr = ScratchArenaAlloc(arena, newSize);
+    memcpy(newPtr, ptr, oldSize);
+
+    return newPtr;
+}
+
+void ScratchArenaReset(ScratchArena *arena) {
+    ScratchArenaBlock *largest = arena->blocks;
+    for (ScratchArenaBlock *block = arena->blocks; block != NULL; block = block->next) {
+        if (block->size > largest->size) {
+            largest = block;
+        }
+    }
+
+    ScratchArenaBlock *block = arena->blocks;
+    while (block != NULL) {
+        ScratchArenaBlock *next = block->next;
+        if (block != largest) {
+            free(block);
+        }
+        block = next;
+    }
+
+    if (largest != NULL) {
+        largest->next = NULL;
+        largest->used = 0;
+    }
+    arena->blocks = largest;
+    arena->usedBytes = 0;
+}
+
+size_t ScratchArenaUsedBytes(ScratchArena *arena) {
+    return arena->usedBytes;
+}
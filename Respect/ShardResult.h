@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Partial lint result written by --shard and combined by respect merge.
+ * Holds the ResourceLinter shardRun of each target and configuration
+ * linted by one shard. Stored as a binary property list where repeated
+ * strings like paths are only written once.
+ */
+
+#import "ResourceLinter.h"
+
+extern NSString * const ShardResultErrorDomain;
+
+@interface ShardResult : NSObject
+@property(nonatomic, assign, readonly) NSUInteger shardIndex;
+@property(nonatomic, assign, readonly) NSUInteger shardCount;
+// project or workspace path as given on command line
+@property(nonatomic, copy, readonly) NSString *projectPath;
+// ResourceLinter shardRun dictionaries in lint order
+@property(nonatomic, strong, readonly) NSArray *runs;
+
+// parse "i/N" where i is zero based, returns NO if invalid
++ (BOOL)parseShardString:(NSString *)string
+              shardIndex:(NSUInteger *)shardIndex
+              shardCount:(NSUInteger *)shardCount;
+// read results of all shards, fails unless each of the N shards is
+// included exactly once. sorted by shard index
++ (NSArray *)shardResultsWithContentsOfFiles:(NSArray *)paths error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithShardIndex:(NSUInteger)shardIndex
+                        shardCount:(NSUInteger)shardCount
+                       projectPath:(NSString *)projectPath NS_DESIGNATED_INITIALIZER;
+- (void)addRun:(NSDictionary *)run;
+// runs for the same project, target and configuration in all shardResults
++ (NSArray *)runsInShardResults:(NSArray *)shardResults
+                    projectName:(NSString *)projectName
+                     targetName:(NSString *)targetName
+              configurationName:(NSString *)configurationName;
+- (BOOL)writeToPath:(NSString *)path error:(NSError **)error;
+@end
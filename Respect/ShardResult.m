@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ShardResult.h"
+
+NSString * const ShardResultErrorDomain = @"ShardResultErrorDomain";
+
+static const NSUInteger kShardResultVersion = 1;
+
+static NSError *makeShardResultError(NSString *format, ...) {
+    va_list ap;
+    va_start(ap, format);
+    NSString *description = [[NSString alloc]
+                             initWithFormat:format arguments:ap];
+    va_end(ap);
+
+    return [NSError errorWithDomain:ShardResultErrorDomain
+                               code:0
+                           userInfo:@{NSLocalizedDescriptionKey: description}];
+}
+
+@interface ShardResult ()
+@property(nonatomic, assign, readwrite) NSUInteger shardIndex;
+@property(nonatomic, assign, readwrite) NSUInteger shardCount;
+@property(nonatomic, copy, readwrite) NSString *projectPath;
+@property(nonatomic, strong, readwrite) NSMutableArray *runs;
+@end
+
+@implementation ShardResult
+
++ (BOOL)parseShardString:(NSString *)string
+              shardIndex:(NSUInteger *)shardIndex
+              shardCount:(NSUInteger *)shardCount {
+    NSScanner *scanner = [NSScanner scannerWithString:string];
+    scanner.charactersToBeSkipped = nil;
+    NSInteger index = 0;
+    NSInteger count = 0;
+    if (!([scanner scanInteger:&index] &&
+          [scanner scanString:@"/" intoString:NULL] &&
+          [scanner scanInteger:&count] &&
+          scanner.atEnd) ||
+        count < 1 || index < 0 || index >= count) {
+        return NO;
+    }
+
+    *shardIndex = (NSUInteger)index;
+    *shardCount = (NSUInteger)count;
+
+    return YES;
+}
+
++ (instancetype)shardResultWithContentsOfFile:(NSString *)path error:(NSError **)error {
+    NSData *data = [NSData dataWithContentsOfFile:path options:0 error:error];
+    if (data == nil) {
+        return nil;
+    }
+
+    NSDictionary *plist = [NSPropertyListSerialization propertyListWithData:data
+                                                                    options:NSPropertyListImmutable
+                                                                     format:NULL
+                                                                      error:error];
+    if (plist == nil) {
+        return nil;
+    }
+    if (![plist isKindOfClass:[NSDictionary class]] ||
+        ![plist[@"version"] isEqual:@(kShardResultVersion)] ||
+        ![plist[@"projectPath"] isKindOfClass:[NSString class]] ||
+        ![plist[@"runs"] isKindOfClass:[NSArray class]]) {
+        if (error != NULL) {
+            *error = makeShardResultError(@"%@: Not a shard result or unsupported version", path);
+        }
+        return nil;
+    }
+
+    ShardResult *shardResult = [[self alloc]
+                                initWithShardIndex:[plist[@"shardIndex"] unsignedIntegerValue]
+                                shardCount:[plist[@"shardCount"] unsignedIntegerValue]
+                                projectPath:plist[@"projectPath"]];
+    for (NSDictionary *run in plist[@"runs"]) {
+        [shardResult addRun:run];
+    }
+
+    return shardResult;
+}
+
++ (NSArray *)shardResultsWithContentsOfFiles:(NSArray *)paths error:(NSError **)error {
+    NSMutableArray *shardResults = [NSMutableArray array];
+    for (NSString *path in paths) {
+        ShardResult *shardResult = [self shardResultWithContentsOfFile:path error:error];
+        if (shardResult == nil) {
+            return nil;
+        }
+        [shardResults addObject:shardResult];
+    }
+
+    [shardResults sortUsingComparator:^NSComparisonResult(ShardResult *a, ShardResult *b) {
+        return [@(a.shardIndex) compare:@(b.shardIndex)];
+    }];
+
+    ShardResult *first = shardResults.firstObject;
+    if (first == nil) {
+        if (error != NULL) {
+            *error = makeShardResultError(@"No shard results to merge");
+        }
+        return nil;
+    }
+
+    for (NSUInteger i = 0; i < shardResults.count; i++) {
+        ShardResult *shardResult = shardResults[i];
+        if (shardResult.shardCount != first.shardCount ||
+            ![shardResult.projectPath isEqualToString:first.projectPath]) {
+            if (error != NULL) {
+                *error = makeShardResultError(@"Shard results are from different lint runs");
+            }
+            return nil;
+        }
+        if (shardResult.shardIndex < i) {
+            if (error != NULL) {
+                *error = makeShardResultError(@"Shard %ld/%ld is included more than once",
+                                              shardResult.shardIndex, first.shardCount);
+            }
+            return nil;
+        } else if (shardResult.shardIndex > i) {
+            if (error != NULL) {
+                *error = makeShardResultError(@"Shard %ld/%ld is missing", i, first.shardCount);
+            }
+            return nil;
+        }
+    }
+    if (shardResults.count != first.shardCount) {
+        if (error != NULL) {
+            *error = makeShardResultError(@"Shard %ld/%ld is missing",
+                                          shardResults.count, first.shardCount);
+        }
+        return nil;
+    }
+
+    return shardResults;
+}
+
+- (instancetype)initWithShardIndex:(NSUInteger)shardIndex
+                        shardCount:(NSUInteger)shardCount
+                       projectPath:(NSString *)projectPath {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.shardIndex = shardIndex;
+    self.shardCount = shardCount;
+    self.projectPath = projectPath;
+    self.runs = [NSMutableArray array];
+
+    return self;
+}
+
+- (void)addRun:(NSDictionary *)run {
+    [self.runs addObject:run];
+}
+
++ (NSArray *)runsInShardResults:(NSArray *)shardResults
+                    projectName:(NSString *)projectName
+                     targetName:(NSString *)targetName
+              configurationName:(NSString *)configurationName {
+    NSMutableArray *runs = [NSMutableArray array];
+    for (ShardResult *shardResult in shardResults) {
+        for (NSDictionary *run in shardResult.runs) {
+            if ([run[@"project"] isEqualToString:projectName] &&
+                [run[@"target"] isEqualToString:targetName] &&
+                [run[@"configuration"] isEqualToString:configurationName]) {
+                [runs addObject:run];
+            }
+        }
+    }
+
+    return runs;
+}
+
+- (BOOL)writeToPath:(NSString *)path error:(NSError **)error {
+    NSDictionary *plist = @{@"version": @(kShardResultVersion),
+                            @"shardIndex": @(self.shardIndex),
+                            @"shardCount": @(self.shardCount),
+                            @"projectPath": self.projectPath,
+                            @"runs": self.runs};
+    NSData *data = [NSPropertyListSerialization dataWithPropertyList:plist
+                                                              format:NSPropertyListBinaryFormat_v1_0
+                                                             options:0
+                                                               error:error];
+    if (data == nil) {
+        return NO;
+    }
+
+    return [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
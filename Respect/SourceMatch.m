@@ -27,6 +27,8 @@
 @property(nonatomic, strong, readwrite) ExpressionSignature *experssionSignature;
 @property(nonatomic, strong, readwrite) NSRegularExpression *re;
 @property(nonatomic, strong, readwrite) NSError *error;
+// reused for all matches
+@property(nonatomic, strong, readwrite) PerformParameters *reusedParameters;
 @end
 
 @implementation SourceMatch
@@ -51,6 +53,7 @@
     
     NSError *error = nil;
     
+    self.reusedParameters = [[PerformParameters alloc] init];
     self.error = nil;
     if ([argumentString hasPrefix:@"/"]) {
         self.re = [NSRegularExpression
@@ -61,15 +64,9 @@
         self.experssionSignature = [ExpressionSignature
                                     signatureFromString:argumentString
                                     error:&error];
-        if (self.experssionSignature != nil) {
-            self.re = [NSRegularExpression
-                       regularExpressionWithPattern:[self.experssionSignature toPattern]
-                       options:0
-                       error:&error];
-        }
     }
     
-    if (self.re == nil) {
+    if (self.re == nil && self.experssionSignature == nil) {
         self.error = error;
         [self.linter.configErrors addObject:
          [ConfigError configErrorWithFile:file
@@ -83,7 +80,61 @@
 }
 
 
+- (void)performActionsWithText:(NSString *)text
+                        ranges:(const NSRange *)ranges
+                         count:(NSUInteger)count
+                          path:(NSString *)path
+                  textLocation:(TextLocation)textLocation {
+    [self.reusedParameters resetWithText:text
+                                  ranges:ranges
+                                   count:count
+                                unescape:YES
+                                    path:path
+                            textLocation:textLocation];
+    [self performActionsWithParameters:self.reusedParameters];
+}
+
+- (void)parseSignatureReferencesInSourceFile:(TextFile *)textFile {
+    NSArray *lineRanges = textFile.lineRanges;
+    __block NSUInteger lineIndex = 0;
+
+    [ExpressionSignature
+     enumerateMatchesOfSignature:self.experssionSignature
+     inSourceTokens:textFile.sourceTokens
+     usingBlock:^(NSRange range, NSArray *captureRanges, BOOL *stop) {
+         // matches are in order so line index only moves forward
+         while (lineIndex+1 < lineRanges.count &&
+                !NSLocationInRange(range.location, [lineRanges[lineIndex] rangeValue])) {
+             lineIndex++;
+         }
+
+         NSRange inLineRange = range;
+         // range inside current line starting from 1
+         if (lineIndex < lineRanges.count) {
+             inLineRange.location -= [lineRanges[lineIndex] rangeValue].location-1;
+         }
+
+         NSUInteger count = captureRanges.count + 1;
+         NSRange ranges[count];
+         ranges[0] = range;
+         for (NSUInteger i = 1; i < count; i++) {
+             ranges[i] = [captureRanges[i-1] rangeValue];
+         }
+
+         [self performActionsWithText:textFile.text
+                               ranges:ranges
+                                count:count
+                                 path:textFile.path
+                         textLocation:MakeTextLocation(lineIndex+1, inLineRange)];
+     }];
+}
+
 - (void)parseResourceReferencesInSourceFile:(TextFile *)textFile {
+    if (self.re == nil) {
+        [self parseSignatureReferencesInSourceFile:textFile];
+        return;
+    }
+
     // we can use lineRanges from textFile as comment white out only
     // replaces the comment text with whitesapce and leaves new lines alone
     [self.re enumerateMatchesWithLineNumberInString:textFile.whitedoutCommentsText
@@ -93,22 +144,17 @@
                                          usingBlock:
      ^(NSTextCheckingResult *result, NSUInteger lineNumber, NSRange inLineRange,
        NSMatchingFlags flags, BOOL *stop) {
-         NSMutableArray *parameters = [NSMutableArray array];
-         for (NSUInteger i = 0; i < result.numberOfRanges; i++) {
-             NSRange r =  [result rangeAtIndex:i];
-             NSString *parameter = [[textFile.text substringWithRange:r] respect_stringByUnEscaping];
-             [parameters addObject:parameter];
+         NSUInteger count = result.numberOfRanges;
+         NSRange ranges[count];
+         for (NSUInteger i = 0; i < count; i++) {
+             ranges[i] = [result rangeAtIndex:i];
          }
          
-         PerformParameters *performParameters = [PerformParameters
-                                                 performParametersWithParameters:parameters
-                                                 path:textFile.path
-                                                 textLocation:MakeTextLocation(lineNumber, inLineRange)];
-         [self.performParameters addObject:performParameters];
-         
-         for (AbstractAction *action in self.actions) {
-             [action performWithParameters:performParameters];
-         }
+         [self performActionsWithText:textFile.text
+                               ranges:ranges
+                                count:count
+                                 path:textFile.path
+                         textLocation:MakeTextLocation(lineNumber, inLineRange)];
      }];
 }
 
@@ -127,10 +173,25 @@
     
     for (TextFile *textFile in
          [[self.linter.linterSource sourceTextFiles] objectEnumerator]) {
-        [self parseResourceReferencesInSourceFile:textFile];
+        if (![self.linter shardContainsPath:textFile.path]) {
+            continue;
+        }
+
+        // capture arrays and action strings of all hits in a file are
+        // released before next file
+        @autoreleasepool {
+            [self parseResourceReferencesInSourceFile:textFile];
+        }
     }
+    // don't keep last file text alive until the matcher is freed
+    [self.reusedParameters resetWithText:nil
+                                  ranges:NULL
+                                   count:0
+                                unescape:NO
+                                    path:nil
+                            textLocation:MakeTextLineLocation(0)];
     
-    if (!self.isDefaultConfig && (self.performParameters).count == 0) {
+    if (!self.isDefaultConfig && self.matchCount == 0) {
         [self.linter.configErrors addObject:
          [ConfigError configErrorWithFile:self.file
                              textLocation:self.textLocation
@@ -143,7 +204,8 @@
     
     if (self.error == nil) {
         if (![self.argumentString hasPrefix:@"/"]) {
-            [lines addObject:[NSString stringWithFormat:@"// Translated to %@", self.re.pattern]];
+            [lines addObject:[NSString stringWithFormat:@"// Translated to %@",
+                              [self.experssionSignature toPattern]]];
         }
     } else {
         [lines addObject:[NSString stringWithFormat:@"// %@", (self.error).localizedDescription]];
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Tokenizes C/Objective-C source text for expression signature matching.
+// Expects comments to be whited out. Brackets, parentheses and braces are
+// paired in one pass so that a matcher can skip a balanced group in constant
+// time.
+
+#import <Foundation/Foundation.h>
+
+typedef NS_ENUM(NSInteger, SourceTokenType) {
+    SOURCE_TOKEN_IDENT,
+    SOURCE_TOKEN_STRING, // "..." or @"...", range includes @ and quotes
+    SOURCE_TOKEN_CHAR,
+    SOURCE_TOKEN_NUMBER,
+    SOURCE_TOKEN_OPEN_BRACKET,
+    SOURCE_TOKEN_CLOSE_BRACKET,
+    SOURCE_TOKEN_OPEN_PARENTHESES,
+    SOURCE_TOKEN_CLOSE_PARENTHESES,
+    SOURCE_TOKEN_OPEN_BRACE,
+    SOURCE_TOKEN_CLOSE_BRACE,
+    SOURCE_TOKEN_COLON,
+    SOURCE_TOKEN_COMMA,
+    SOURCE_TOKEN_SEMICOLON,
+    SOURCE_TOKEN_OTHER
+};
+
+typedef struct _SourceToken {
+    SourceTokenType type;
+    NSRange range;
+    // index of paired open/close token or NSNotFound if unbalanced
+    NSUInteger pair;
+} SourceToken;
+
+@interface SourceTokens : NSObject
+@property(nonatomic, assign, readonly) NSUInteger count;
+
+- (instancetype)init NS_UNAVAILABLE;
+- (instancetype)initWithString:(NSString *)string NS_DESIGNATED_INITIALIZER;
+
+- (const SourceToken *)tokenAtIndex:(NSUInteger)index;
+- (BOOL)tokenAtIndex:(NSUInteger)index isType:(SourceTokenType)type;
+// ident token that matches name, "*" in name is wildcard
+- (BOOL)tokenAtIndex:(NSUInteger)index matchesIdent:(NSString *)name;
+// range of string literal content without @ and quotes
+- (NSRange)stringContentRangeOfTokenAtIndex:(NSUInteger)index;
+@end
@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "SourceTokens.h"
+
+@interface SourceTokens () {
+    unichar *_characters;
+    SourceToken *_tokens;
+}
+@property(nonatomic, assign, readwrite) NSUInteger count;
+@property(nonatomic, assign, readwrite) NSUInteger length;
+@end
+
+static BOOL isIdentFirstCharacter(unichar c) {
+    return ((c >= 'a' && c <= 'z') ||
+            (c >= 'A' && c <= 'Z') ||
+            c == '_' || c == '$' ||
+            c >= 0x80);
+}
+
+static BOOL isIdentCharacter(unichar c) {
+    return isIdentFirstCharacter(c) || (c >= '0' && c <= '9');
+}
+
+static BOOL isWhitespaceCharacter(unichar c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// "*" matches zero or more characters, only backtracks to last "*" so
+// worst case is length of pattern times length of string
+static BOOL wildcardMatch(const unichar *pattern, NSUInteger patternLength,
+                          const unichar *string, NSUInteger stringLength) {
+    NSUInteger p = 0;
+    NSUInteger s = 0;
+    NSUInteger star = NSNotFound;
+    NSUInteger mark = 0;
+
+    while (s < stringLength) {
+        if (p < patternLength && pattern[p] == '*') {
+            star = p++;
+            mark = s;
+        } else if (p < patternLength && pattern[p] == string[s]) {
+            p++;
+            s++;
+        } else if (star != NSNotFound) {
+            p = star + 1;
+            s = ++mark;
+        } else {
+            return NO;
+        }
+    }
+
+    while (p < patternLength && pattern[p] == '*') {
+        p++;
+    }
+
+    return p == patternLength;
+}
+
+@implementation SourceTokens
+
+- (instancetype)initWithString:(NSString *)string {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.length = string.length;
+    _characters = malloc(sizeof(unichar) * (self.length + 1));
+    [string getCharacters:_characters range:NSMakeRange(0, self.length)];
+    [self tokenize];
+
+    return self;
+}
+
+- (void)dealloc {
+    free(_characters);
+    free(_tokens);
+}
+
+// skip until unescaped quote character or end of line
+- (NSUInteger)indexAfterQuote:(unichar)quote fromIndex:(NSUInteger)index {
+    while (index < self.length) {
+        unichar c = _characters[index];
+        if (c == '\\') {
+            index += 2;
+            continue;
+        } else if (c == quote) {
+            return index + 1;
+        } else if (c == '\n') {
+            return index;
+        }
+        index++;
+    }
+
+    return self.length;
+}
+
+- (void)addToken:(SourceTokenType)type range:(NSRange)range capacity:(NSUInteger *)capacity {
+    if (self.count == *capacity) {
+        *capacity = *capacity * 2;
+        _tokens = realloc(_tokens, sizeof(SourceToken) * *capacity);
+    }
+
+    _tokens[self.count] = (SourceToken){.type = type, .range = range, .pair = NSNotFound};
+    self.count++;
+}
+
+- (void)tokenize {
+    NSUInteger length = self.length;
+    const unichar *chars = _characters;
+    // roughly one token per 4 characters in normal source
+    NSUInteger capacity = MAX(length / 4, 16);
+    _tokens = malloc(sizeof(SourceToken) * capacity);
+
+    // stack of unpaired open token indexes
+    NSUInteger openCapacity = 64;
+    NSUInteger openCount = 0;
+    NSUInteger *opens = malloc(sizeof(NSUInteger) * openCapacity);
+
+    NSUInteger i = 0;
+    while (i < length) {
+        unichar c = chars[i];
+        NSUInteger start = i;
+        SourceTokenType type;
+
+        if (isWhitespaceCharacter(c)) {
+            i++;
+            continue;
+        } else if (isIdentFirstCharacter(c)) {
+            while (i < length && isIdentCharacter(chars[i])) {
+                i++;
+            }
+            type = SOURCE_TOKEN_IDENT;
+        } else if (c >= '0' && c <= '9') {
+            while (i < length && (isIdentCharacter(chars[i]) || chars[i] == '.')) {
+                i++;
+            }
+            type = SOURCE_TOKEN_NUMBER;
+        } else if (c == '"' || (c == '@' && i + 1 < length && chars[i + 1] == '"')) {
+            i = [self indexAfterQuote:'"' fromIndex:i + (c == '@' ? 2 : 1)];
+            type = SOURCE_TOKEN_STRING;
+        } else if (c == '\'') {
+            i = [self indexAfterQuote:'\'' fromIndex:i + 1];
+            type = SOURCE_TOKEN_CHAR;
+        } else {
+            i++;
+            switch (c) {
+                case '[': type = SOURCE_TOKEN_OPEN_BRACKET; break;
+                case ']': type = SOURCE_TOKEN_CLOSE_BRACKET; break;
+                case '(': type = SOURCE_TOKEN_OPEN_PARENTHESES; break;
+                case ')': type = SOURCE_TOKEN_CLOSE_PARENTHESES; break;
+                case '{': type = SOURCE_TOKEN_OPEN_BRACE; break;
+                case '}': type = SOURCE_TOKEN_CLOSE_BRACE; break;
+                case ':': type = SOURCE_TOKEN_COLON; break;
+                case ',': type = SOURCE_TOKEN_COMMA; break;
+                case ';': type = SOURCE_TOKEN_SEMICOLON; break;
+                default: type = SOURCE_TOKEN_OTHER; break;
+            }
+        }
+
+        [self addToken:type range:NSMakeRange(start, i - start) capacity:&capacity];
+        NSUInteger index = self.count - 1;
+
+        if (type == SOURCE_TOKEN_OPEN_BRACKET ||
+            type == SOURCE_TOKEN_OPEN_PARENTHESES ||
+            type == SOURCE_TOKEN_OPEN_BRACE) {
+            if (openCount == openCapacity) {
+                openCapacity *= 2;
+                opens = realloc(opens, sizeof(NSUInteger) * openCapacity);
+            }
+            opens[openCount++] = index;
+        } else if (type == SOURCE_TOKEN_CLOSE_BRACKET ||
+                   type == SOURCE_TOKEN_CLOSE_PARENTHESES ||
+                   type == SOURCE_TOKEN_CLOSE_BRACE) {
+            // open type is always one less than close type
+            SourceTokenType openType = type - 1;
+            // find nearest open of same type, opens above it are left unpaired
+            NSUInteger n = openCount;
+            while (n > 0 && _tokens[opens[n - 1]].type != openType) {
+                n--;
+            }
+            if (n > 0) {
+                NSUInteger openIndex = opens[n - 1];
+                _tokens[openIndex].pair = index;
+                _tokens[index].pair = openIndex;
+                openCount = n - 1;
+            }
+        }
+    }
+
+    free(opens);
+}
+
+- (const SourceToken *)tokenAtIndex:(NSUInteger)index {
+    return &_tokens[index];
+}
+
+- (BOOL)tokenAtIndex:(NSUInteger)index isType:(SourceTokenType)type {
+    return index < self.count && _tokens[index].type == type;
+}
+
+- (BOOL)tokenAtIndex:(NSUInteger)index matchesIdent:(NSString *)name {
+    if (![self tokenAtIndex:index isType:SOURCE_TOKEN_IDENT]) {
+        return NO;
+    }
+
+    NSRange range = _tokens[index].range;
+    NSUInteger nameLength = name.length;
+    unichar stackBuffer[128];
+    unichar *nameCharacters = (nameLength <= 128 ?
+                               stackBuffer :
+                               malloc(sizeof(unichar) * nameLength));
+    [name getCharacters:nameCharacters range:NSMakeRange(0, nameLength)];
+
+    BOOL matches = wildcardMatch(nameCharacters, nameLength,
+                                 _characters + range.location, range.length);
+
+    if (nameCharacters != stackBuffer) {
+        free(nameCharacters);
+    }
+
+    return matches;
+}
+
+- (NSRange)stringContentRangeOfTokenAtIndex:(NSUInteger)index {
+    NSRange range = _tokens[index].range;
+    NSUInteger prefix = _characters[range.location] == '@' ? 2 : 1;
+    NSUInteger end = NSMaxRange(range);
+    // unterminated string has no closing quote
+    if (end - range.location > prefix && _characters[end - 1] == '"') {
+        end--;
+    }
+
+    return NSMakeRange(range.location + prefix, end - range.location - prefix);
+}
+
+@end
@@ -0,0 +1,38 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * Collects wall time per pipeline stage and peak RSS for a run. Used by
+ * the --timings option and misc/bench to catch throughput regressions.
+ */
+
+#import <Foundation/Foundation.h>
+
+@interface StageTimings : NSObject
+// stage names in the order they were first started
+@property(nonatomic, strong, readonly) NSArray *stageNames;
+
++ (StageTimings *)sharedTimings;
+
+- (void)startStage:(NSString *)name;
+- (void)stopStage:(NSString *)name;
+// seconds spent in stage, accumulated if started several times
+- (NSTimeInterval)durationForStage:(NSString *)name;
+// peak resident set size in bytes
+- (unsigned long long)peakResidentSize;
+- (NSDictionary *)dictionaryRepresentation;
+- (BOOL)writeToPath:(NSString *)path error:(NSError **)error;
+@end
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "StageTimings.h"
+#include <sys/resource.h>
+
+@interface StageTimings ()
+@property(nonatomic, strong, readwrite) NSMutableArray *stageNames;
+@property(nonatomic, strong, readwrite) NSMutableDictionary *startTimes;
+@property(nonatomic, strong, readwrite) NSMutableDictionary *durations;
+@property(nonatomic, assign, readwrite) CFAbsoluteTime createTime;
+@end
+
+@implementation StageTimings
+
++ (StageTimings *)sharedTimings {
+    static StageTimings *sharedTimings = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedTimings = [[StageTimings alloc] init];
+    });
+
+    return sharedTimings;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.stageNames = [NSMutableArray array];
+    self.startTimes = [NSMutableDictionary dictionary];
+    self.durations = [NSMutableDictionary dictionary];
+    self.createTime = CFAbsoluteTimeGetCurrent();
+
+    return self;
+}
+
+- (void)startStage:(NSString *)name {
+    @synchronized(self) {
+        if (![self.stageNames containsObject:name]) {
+            [self.stageNames addObject:name];
+        }
+        self.startTimes[name] = @(CFAbsoluteTimeGetCurrent());
+    }
+}
+
+- (void)stopStage:(NSString *)name {
+    @synchronized(self) {
+        NSNumber *startTime = self.startTimes[name];
+        if (startTime == nil) {
+            return;
+        }
+
+        NSTimeInterval duration = CFAbsoluteTimeGetCurrent() - startTime.doubleValue;
+        self.durations[name] = @([self.durations[name] doubleValue] + duration);
+        [self.startTimes removeObjectForKey:name];
+    }
+}
+
+- (NSTimeInterval)durationForStage:(NSString *)name {
+    @synchronized(self) {
+        return [self.durations[name] doubleValue];
+    }
+}
+
+- (unsigned long long)peakResidentSize {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+
+    // ru_maxrss is in bytes on darwin
+    return (unsigned long long)usage.ru_maxrss;
+}
+
+- (NSDictionary *)dictionaryRepresentation {
+    NSMutableArray *stages = [NSMutableArray array];
+    @synchronized(self) {
+        for (NSString *name in self.stageNames) {
+            [stages addObject:@{@"name": name,
+                                @"seconds": @([self.durations[name] doubleValue])}];
+        }
+    }
+
+    return @{@"stages": stages,
+             @"totalSeconds": @(CFAbsoluteTimeGetCurrent() - self.createTime),
+             @"peakResidentBytes": @([self peakResidentSize])};
+}
+
+- (BOOL)writeToPath:(NSString *)path error:(NSError **)error {
+    NSData *data = [NSJSONSerialization dataWithJSONObject:[self dictionaryRepresentation]
+                                                   options:NSJSONWritingPrettyPrinted
+                                                     error:error];
+    if (data == nil) {
+        return NO;
+    }
+
+    return [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
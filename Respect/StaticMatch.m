@@ -42,12 +42,20 @@
 }
 
 - (void)performMatch {
+    PerformParameters *performParameters = [[PerformParameters alloc] init];
+
     for (AbstractAction *action in self.actions) {
-        [action performWithParameters:
-         [PerformParameters
-          performParametersWithParameters:[NSArray array]
-          path:action.file
-          textLocation:action.textLocation]];
+        if (![self.linter shardContainsPath:action.file]) {
+            continue;
+        }
+
+        [performParameters resetWithText:nil
+                                  ranges:NULL
+                                   count:0
+                                unescape:NO
+                                    path:action.file
+                            textLocation:action.textLocation];
+        [action performWithParameters:performParameters];
     }
 }
 
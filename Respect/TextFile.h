@@ -15,11 +15,15 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#import "SourceTokens.h"
+
 @interface TextFile : NSObject
 @property(nonatomic, copy, readonly) NSString *path;
 @property(nonatomic, copy, readonly) NSString *text;
 @property(nonatomic, strong, readonly) NSString *whitedoutCommentsText;
 @property(nonatomic, strong, readonly) NSArray *lineRanges;
+// tokens of whitedoutCommentsText used for expression signature matching
+@property(nonatomic, strong, readonly) SourceTokens *sourceTokens;
 
 + (instancetype)textFileWithText:(NSString *)text path:(NSString *)path;
 + (instancetype)textFileWithContentOfFile:(NSString *)file;
@@ -19,14 +19,16 @@
 #import "NSString+Respect.h"
 #import "NSString+lineNumber.h"
 
-// whitedoutCommentsText is here for performance, it is expensive so only do it
-// once per text file instead of everytime a source match is performed.
+// whitedoutCommentsText and sourceTokens are here for performance, they are
+// expensive so only do it once per text file instead of everytime a source
+// match is performed.
 
 @interface TextFile ()
 @property(nonatomic, copy, readwrite) NSString *path;
 @property(nonatomic, copy, readwrite) NSString *text;
 @property(nonatomic, strong, readwrite) NSString *whitedoutCommentsText;
 @property(nonatomic, strong, readwrite) NSArray *lineRanges;
+@property(nonatomic, strong, readwrite) SourceTokens *sourceTokens;
 @end
 
 @implementation TextFile
@@ -117,4 +119,13 @@
     return _whitedoutCommentsText;
 }
 
+- (SourceTokens *)sourceTokens {
+    if (_sourceTokens == nil) {
+        self.sourceTokens = [[SourceTokens alloc]
+                             initWithString:self.whitedoutCommentsText];
+    }
+
+    return _sourceTokens;
+}
+
 @end
@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "TextFileCache.h"
+
+@interface TextFileCache ()
+// path is key, value is TextFile or NSNull if failed to read
+@property(nonatomic, strong, readwrite) NSMutableDictionary *textFiles;
+@end
+
+@implementation TextFileCache
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.textFiles = [NSMutableDictionary dictionary];
+
+    return self;
+}
+
+- (TextFile *)textFileWithContentOfFile:(NSString *)path {
+    id textFile = nil;
+    @synchronized(self) {
+        textFile = self.textFiles[path];
+    }
+
+    if (textFile == nil) {
+        textFile = [TextFile textFileWithContentOfFile:path] ?: [NSNull null];
+        @synchronized(self) {
+            // keep first one if read concurrently
+            textFile = self.textFiles[path] ?: textFile;
+            self.textFiles[path] = textFile;
+        }
+    }
+
+    return textFile == [NSNull null] ? nil : textFile;
+}
+
+- (void)removeTextFilesForPaths:(NSArray *)paths {
+    @synchronized(self) {
+        [self.textFiles removeObjectsForKeys:paths];
+    }
+}
+
+@end
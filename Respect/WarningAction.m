@@ -17,7 +17,11 @@
 
 #import "WarningAction.h"
 #import "LintWarning.h"
-#import "NSString+Respect.h"
+#import "ParameterTemplate.h"
+
+@interface WarningAction ()
+@property(nonatomic, strong, readwrite) ParameterTemplate *messageTemplate;
+@end
 
 @implementation WarningAction
 
@@ -25,12 +29,31 @@
     return @"Warning";
 }
 
+- (id)initWithLinter:(ResourceLinter *)linter
+                file:(NSString *)file
+        textLocation:(TextLocation)textLocation
+      argumentString:(NSString *)argumentString
+     isDefaultConfig:(BOOL)isDefaultConfig {
+    self = [super initWithLinter:linter
+                            file:file
+                    textLocation:textLocation
+                  argumentString:argumentString
+                 isDefaultConfig:isDefaultConfig];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.messageTemplate = [ParameterTemplate templateWithString:argumentString];
+
+    return self;
+}
+
 - (void)performWithParameters:(PerformParameters *)parameters {
     [self.linter.lintWarnings addObject:
      [LintWarning lintWarningWithFile:parameters.path
                          textLocation:parameters.textLocation
-                              message:[self.argumentString
-                                       respect_stringByReplacingParameters:parameters.parameters]]];
+                              message:[self.messageTemplate
+                                       stringByReplacingParameters:parameters.parameters]]];
 }
 
 - (NSArray *)configLines {
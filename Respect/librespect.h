@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+/*
+ * C API for linting from other programs without starting respect and
+ * parsing its output. A project is opened once and can be linted again
+ * after telling which files changed, only those are read again.
+ *
+ * Strings are UTF-8. Strings and results returned are owned by the object
+ * they came from, error strings are freed with respect_free. A project and
+ * its lints must only be used from one thread at a time.
+ *
+ * Functions and structs are only added, and struct fields only appended,
+ * in new API versions.
+ */
+
+#ifndef LIBRESPECT_H
+#define LIBRESPECT_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RESPECT_API_VERSION 1
+
+typedef struct respect_project respect_project;
+typedef struct respect_lint respect_lint;
+
+typedef enum {
+    RESPECT_OPTION_NONE = 0,
+    // warn about bundle resources with identical content
+    RESPECT_OPTION_DUPLICATES = 1 << 0,
+    // warn about @2x images not twice the size of @1x and oversized images
+    RESPECT_OPTION_IMAGE_SIZES = 1 << 1
+} respect_option;
+
+// zero initialized means first native target, Release configuration,
+// $SRCROOT/.respect and default configuration
+typedef struct {
+    const char *target_name;
+    const char *configuration_name;
+    const char *config_path;
+    int no_default_config;
+    // respect_option flags
+    unsigned int options;
+} respect_lint_options;
+
+typedef enum {
+    RESPECT_RESULT_LINT_ERROR,
+    RESPECT_RESULT_CONFIG_ERROR,
+    RESPECT_RESULT_MISSING_RESOURCE,
+    RESPECT_RESULT_UNUSED_RESOURCE,
+    RESPECT_RESULT_WARNING
+} respect_result_kind;
+
+typedef struct {
+    respect_result_kind kind;
+    // absolute path of file, for unused resources the resource file
+    const char *path;
+    // 0 if not known
+    unsigned long line;
+    unsigned long column;
+    // bundle path of missing or unused resource, NULL otherwise
+    const char *resource_path;
+    // same message as in Xcode
+    const char *message;
+} respect_result;
+
+unsigned int respect_api_version(void);
+void respect_free(void *pointer);
+
+// path to .xcodeproj or project.pbxproj. NULL on failure and error is set if
+// not NULL
+respect_project *respect_project_open(const char *path, char **error);
+void respect_project_close(respect_project *project);
+// target names are valid until the project is read again or closed
+size_t respect_project_target_count(respect_project *project);
+const char *respect_project_target_name(respect_project *project, size_t index);
+// paths of changed, added or removed files, relative paths are resolved
+// against the current directory. the project is read again if its project
+// file or a xcconfig file is one of them. returns 0 and sets error if the
+// project could not be read, it is then left as it was
+int respect_project_files_changed(respect_project *project,
+                                  const char *const *paths,
+                                  size_t count,
+                                  char **error);
+
+// NULL on failure and error is set if not NULL, options can be NULL
+respect_lint *respect_lint_target(respect_project *project,
+                                  const respect_lint_options *options,
+                                  char **error);
+void respect_lint_free(respect_lint *lint);
+// in report order: lint errors, config errors, missing, unused and warnings
+size_t respect_lint_result_count(const respect_lint *lint);
+const respect_result *respect_lint_result(const respect_lint *lint, size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,307 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "librespect.h"
+#import "LintSession.h"
+#import "LintError.h"
+#import "ConfigError.h"
+#import "LintWarning.h"
+#import "ResourceReference.h"
+#import "BundleResource.h"
+
+struct respect_project {
+    // retained LintSession
+    void *session;
+    // malloc:ed array of strdup:ed names
+    char **targetNames;
+    size_t targetCount;
+};
+
+struct respect_lint {
+    // malloc:ed array, result strings are strdup:ed
+    respect_result *results;
+    size_t count;
+};
+
+static char *copy_string(NSString *string) {
+    const char *utf8 = string.UTF8String;
+    return utf8 != NULL ? strdup(utf8) : NULL;
+}
+
+static void set_error(char **error, NSString *format, ...) {
+    if (error == NULL) {
+        return;
+    }
+
+    va_list ap;
+    va_start(ap, format);
+    NSString *message = [[NSString alloc] initWithFormat:format arguments:ap];
+    va_end(ap);
+
+    *error = strdup(message.UTF8String ?: "");
+}
+
+static NSString *string_or_nil(const char *string) {
+    return string != NULL ? @(string) : nil;
+}
+
+static void free_target_names(respect_project *project) {
+    for (size_t i = 0; i < project->targetCount; i++) {
+        free(project->targetNames[i]);
+    }
+    free(project->targetNames);
+    project->targetNames = NULL;
+    project->targetCount = 0;
+}
+
+static void update_target_names(respect_project *project) {
+    LintSession *session = (__bridge LintSession *)project->session;
+    NSArray *names = [session.pbxProject nativeTargetNames];
+
+    free_target_names(project);
+    project->targetNames = malloc(MAX(names.count, 1) * sizeof(char *));
+    project->targetCount = names.count;
+    for (NSUInteger i = 0; i < names.count; i++) {
+        project->targetNames[i] = copy_string(names[i]);
+    }
+}
+
+static void add_result(respect_lint *lint,
+                       respect_result_kind kind,
+                       NSString *path,
+                       TextLocation textLocation,
+                       NSString *resourcePath,
+                       NSString *message) {
+    lint->results[lint->count++] = (respect_result){
+        .kind = kind,
+        .path = copy_string(path),
+        .line = textLocation.lineNumber,
+        .column = textLocation.inLineRange.location,
+        .resource_path = copy_string(resourcePath),
+        .message = copy_string(message)
+    };
+}
+
+static respect_lint *lint_from_linter(ResourceLinter *linter) {
+    respect_lint *lint = calloc(1, sizeof(respect_lint));
+    size_t count = (linter.lintErrors.count +
+                    linter.configErrors.count +
+                    linter.missingReferences.count +
+                    linter.unusedResources.count +
+                    linter.lintWarnings.count);
+    lint->results = malloc(MAX(count, 1) * sizeof(respect_result));
+
+    for (LintError *lintError in linter.lintErrors) {
+        add_result(lint, RESPECT_RESULT_LINT_ERROR, lintError.file,
+                   lintError.textLocation, nil, lintError.message);
+    }
+
+    for (ConfigError *configError in linter.configErrors) {
+        add_result(lint, RESPECT_RESULT_CONFIG_ERROR, configError.file,
+                   configError.textLocation, nil, configError.message);
+    }
+
+    for (ResourceReference *resourceRef in linter.missingReferences) {
+        add_result(lint, RESPECT_RESULT_MISSING_RESOURCE, resourceRef.referencePath,
+                   resourceRef.referenceLocation, resourceRef.resourcePath,
+                   [resourceRef missingResourceMessage]);
+    }
+
+    for (BundleResource *bundleRes in linter.unusedResources) {
+        add_result(lint, RESPECT_RESULT_UNUSED_RESOURCE, bundleRes.buildSourcePath,
+                   MakeTextLocation(0, NSMakeRange(0, 0)), bundleRes.path,
+                   [bundleRes unusedResourceMessage]);
+    }
+
+    for (LintWarning *lintWarning in linter.lintWarnings) {
+        add_result(lint, RESPECT_RESULT_WARNING, lintWarning.file,
+                   lintWarning.textLocation, nil, lintWarning.message);
+    }
+
+    return lint;
+}
+
+unsigned int respect_api_version(void) {
+    return RESPECT_API_VERSION;
+}
+
+void respect_free(void *pointer) {
+    free(pointer);
+}
+
+respect_project *respect_project_open(const char *path, char **error) {
+    @autoreleasepool {
+        NSString *projectPath = string_or_nil(path);
+        if (projectPath == nil) {
+            set_error(error, @"Invalid project path");
+            return NULL;
+        }
+
+        NSError *sessionError = nil;
+        LintSession *session = [LintSession sessionWithProjectPath:projectPath
+                                                             error:&sessionError];
+        if (session == nil) {
+            set_error(error, @"Failed to read %@: %@", projectPath,
+                      sessionError.localizedDescription);
+            return NULL;
+        }
+
+        respect_project *project = calloc(1, sizeof(respect_project));
+        project->session = (__bridge_retained void *)session;
+        update_target_names(project);
+
+        return project;
+    }
+}
+
+void respect_project_close(respect_project *project) {
+    if (project == NULL) {
+        return;
+    }
+
+    @autoreleasepool {
+        CFBridgingRelease(project->session);
+    }
+    free_target_names(project);
+    free(project);
+}
+
+size_t respect_project_target_count(respect_project *project) {
+    return project->targetCount;
+}
+
+const char *respect_project_target_name(respect_project *project, size_t index) {
+    return index < project->targetCount ? project->targetNames[index] : NULL;
+}
+
+int respect_project_files_changed(respect_project *project,
+                                  const char *const *paths,
+                                  size_t count,
+                                  char **error) {
+    @autoreleasepool {
+        LintSession *session = (__bridge LintSession *)project->session;
+        NSMutableArray *changedPaths = [NSMutableArray arrayWithCapacity:count];
+        for (size_t i = 0; i < count; i++) {
+            NSString *path = string_or_nil(paths[i]);
+            if (path != nil) {
+                [changedPaths addObject:path];
+            }
+        }
+
+        PBXProject *pbxProject = session.pbxProject;
+        NSError *reloadError = nil;
+        if (![session reloadChangedPaths:changedPaths error:&reloadError]) {
+            set_error(error, @"Failed to read %@: %@", [session.pbxProject projectPath],
+                      reloadError.localizedDescription);
+            return 0;
+        }
+        // target names stay valid if the project was not read again
+        if (session.pbxProject != pbxProject) {
+            update_target_names(project);
+        }
+
+        return 1;
+    }
+}
+
+respect_lint *respect_lint_target(respect_project *project,
+                                  const respect_lint_options *options,
+                                  char **error) {
+    @autoreleasepool {
+        static const respect_lint_options defaultOptions;
+        options = options ?: &defaultOptions;
+        LintSession *session = (__bridge LintSession *)project->session;
+        PBXProject *pbxProject = session.pbxProject;
+
+        PBXNativeTarget *nativeTarget = nil;
+        NSString *targetName = string_or_nil(options->target_name);
+        if (targetName != nil) {
+            nativeTarget = [pbxProject nativeTargetNamed:targetName];
+            if (nativeTarget == nil) {
+                set_error(error, @"No native target named \"%@\" found.", targetName);
+                return NULL;
+            }
+        } else {
+            NSArray *nativeTargets = [pbxProject nativeTargets];
+            if (nativeTargets.count == 0) {
+                set_error(error, @"No native targets found in project file.");
+                return NULL;
+            }
+            nativeTarget = nativeTargets[0];
+        }
+
+        NSString *configurationName = string_or_nil(options->configuration_name) ?: @"Release";
+        XCBuildConfiguration *buildConfiguration = [nativeTarget
+                                                    configurationNamed:configurationName];
+        if (buildConfiguration == nil) {
+            set_error(error, @"No configuration named \"%@\" found for native target \"%@\".",
+                      configurationName, nativeTarget.name);
+            return NULL;
+        }
+
+        ResourceLinterOptions linterOptions = ResourceLinterOptionNone;
+        if (options->options & RESPECT_OPTION_DUPLICATES) {
+            linterOptions |= ResourceLinterOptionDuplicateContent;
+        }
+        if (options->options & RESPECT_OPTION_IMAGE_SIZES) {
+            linterOptions |= ResourceLinterOptionImageSizes;
+        }
+
+        NSError *lintError = nil;
+        ResourceLinter *linter = [session lintNativeTarget:nativeTarget
+                                        buildConfiguration:buildConfiguration
+                                               environment:nil
+                                                configPath:string_or_nil(options->config_path)
+                                        parseDefaultConfig:!options->no_default_config
+                                                   options:linterOptions
+                                            spFeaturesPath:nil
+                                                shardIndex:0
+                                                shardCount:1
+                                                 shardRuns:nil
+                                                  delegate:nil
+                                                     error:&lintError];
+        if (linter == nil) {
+            set_error(error, @"%@: %@", [pbxProject projectPath],
+                      lintError.localizedDescription);
+            return NULL;
+        }
+
+        return lint_from_linter(linter);
+    }
+}
+
+void respect_lint_free(respect_lint *lint) {
+    if (lint == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < lint->count; i++) {
+        free((void *)lint->results[i].path);
+        free((void *)lint->results[i].resource_path);
+        free((void *)lint->results[i].message);
+    }
+    free(lint->results);
+    free(lint);
+}
+
+size_t respect_lint_result_count(const respect_lint *lint) {
+    return lint->count;
+}
+
+const respect_result *respect_lint_result(const respect_lint *lint, size_t index) {
+    return index < lint->count ? &lint->results[index] : NULL;
+}
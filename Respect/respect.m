@@ -15,13 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#import "ResourceLinter.h"
-#import "PBXProject.h"
-#import "ResourceLinterXcodeProjectSource.h"
+#import "LintSession.h"
+#import "XCWorkspace.h"
 #import "ResourceLinterAbstractReport.h"
 #import "ResourceLinterXcodeReport.h"
 #import "ResourceLinterCliReport.h"
 #import "ResourceLinterConfigReport.h"
+#import "StageTimings.h"
+#import "BundleSizeStats.h"
+#import "ShardResult.h"
+#import "ReferenceIndex.h"
+#import "NSString+Respect.h"
 #include <getopt.h>
 
 static void fprintf_nsstring(FILE *stream, NSString *format, va_list va) {
@@ -38,27 +42,274 @@ static void print_error(NSString *format, ...) {
 }
 
 static void help(const char *argv0) {
-    printf("Usage: %s [-cndv] XcodeProjectPath [TargetName] [ConfigurationName]\n"
+    printf("Usage: %s [-cndta] XcodeProjectPath [TargetName] [ConfigurationName]\n"
+           "       %s merge [-cn] ShardResultPath...\n"
+           "       %s query --index Path --references-to Path | --referenced-by Path\n"
            "  XcodeProjectPath                   Path to XcodeProject file or directory\n"
+           "                                     or to a .xcworkspace\n"
            "  TargetName (First native target)   Native target name to lint\n"
            "  ConfigurationName (Release)        Build configuration name\n"
            "\n"
            "  No arguments are required when running as a Xcode run script.\n"
            "\n"
-           "  -c, --config Path   Configuration file ($SRCROOT/.respect)\n"
-           "  -n, --nodefault     Don't use default configuration\n"
-           "  -d, --dumpconfig    Dump interpreted configuration\n"
-           "  --spfeatures Path   Spotify features path\n"
+           "  -c, --config Path       Configuration file ($SRCROOT/.respect)\n"
+           "  -n, --nodefault         Don't use default configuration\n"
+           "  -d, --dumpconfig        Dump interpreted configuration\n"
+           "  -t, --timings Path      Write stage timings and peak RSS as JSON\n"
+           "  -a, --all-targets       Lint all native targets\n"
+           "  --target Name           Native target to lint, can be repeated\n"
+           "  --configuration Name    Build configuration to lint, can be repeated\n"
+           "  --scheme Name           Lint targets built by workspace shared scheme\n"
+           "  --duplicates            Warn about resources with identical content\n"
+           "  --image-sizes           Warn about mismatching @2x and oversized images\n"
+           "  --sizes                 Report bytes of referenced and unused resources\n"
+           "  --sizes-output Path     Write sizes as CSV if Path ends with .csv else JSON\n"
+           "  --spfeatures Path       Spotify features path\n"
+           "  --shard i/N             Only match part i of N of sources and resources\n"
+           "  --shard-output Path     Write shard result to Path instead of a report\n"
+           "  --index Path            Update reference index at Path after linting\n"
+           "\n"
+           "  merge combines shard results of all N shards into a report. Use the same\n"
+           "  options as for the shards, --duplicates, --image-sizes and --sizes are\n"
+           "  only done when merging.\n"
+           "\n"
+           "  query answers from a reference index without reading the project. Paths\n"
+           "  match if equal or a suffix after a \"/\".\n"
+           "  --references-to Path    Files and lines referencing bundle resource Path\n"
+           "  --referenced-by Path    Resources referenced by source file Path\n"
            ,
-           argv0);
+           argv0, argv0, argv0);
 }
 
-int main(int argc,  char *const argv[]) {
+// lint one target and configuration and write report to stdout
+static BOOL lint_target(LintSession *session,
+                        PBXNativeTarget *nativeTarget,
+                        XCBuildConfiguration *buildConfiguration,
+                        NSDictionary *env,
+                        NSString *header,
+                        Class lintReportClass,
+                        NSString *configPath,
+                        BOOL parseDefaultConfig,
+                        ResourceLinterOptions linterOptions,
+                        NSString *spFeaturesPath,
+                        NSMutableArray *sizeStats,
+                        ShardResult *shardResult,
+                        NSArray *mergeShardResults,
+                        ReferenceIndexWriter *indexWriter) {
+    StageTimings *timings = [StageTimings sharedTimings];
+    PBXProject *pbxProject = session.pbxProject;
+    NSError *error = nil;
+
+    // merge what the shards found for this project, target and configuration
+    NSArray *shardRuns = nil;
+    if (mergeShardResults != nil) {
+        shardRuns = [ShardResult runsInShardResults:mergeShardResults
+                                        projectName:[pbxProject projectName]
+                                         targetName:nativeTarget.name
+                                  configurationName:buildConfiguration.name];
+        if (shardRuns.count != mergeShardResults.count) {
+            print_error(@"%@: Shard results are missing target \"%@\" configuration \"%@\"",
+                        [pbxProject projectPath], nativeTarget.name,
+                        buildConfiguration.name);
+            return NO;
+        }
+    }
+
+    // no report for a shard, missing and unused are not known yet. otherwise
+    // the report writes issues known while linting and the rest when done
+    ResourceLinterAbstractReport *lintReport = nil;
+    if (shardResult == nil) {
+        if (header != nil) {
+            fprintf(stdout, "%s\n", header.UTF8String);
+        }
+        lintReport = [[lintReportClass alloc] initWithOutputStream:stdout];
+    }
+
+    ResourceLinter *linter = [session lintNativeTarget:nativeTarget
+                                    buildConfiguration:buildConfiguration
+                                           environment:env
+                                            configPath:configPath
+                                    parseDefaultConfig:parseDefaultConfig
+                                               options:linterOptions
+                                        spFeaturesPath:spFeaturesPath
+                                            shardIndex:shardResult != nil ? shardResult.shardIndex : 0
+                                            shardCount:shardResult != nil ? shardResult.shardCount : 1
+                                             shardRuns:shardRuns
+                                              delegate:lintReport
+                                                 error:&error];
+    if (linter == nil) {
+        print_error(@"%@: %@", [pbxProject projectPath], error.localizedDescription);
+        return NO;
+    }
+    if (shardResult != nil) {
+        [shardResult addRun:linter.shardRun];
+        return YES;
+    }
+    if (linter.bundleSizeStats != nil) {
+        [sizeStats addObject:linter.bundleSizeStats];
+    }
+    [indexWriter addLinter:linter];
+
+    [timings startStage:@"report"];
+    [lintReport writeReport];
+    [lintReport flush];
+    [timings stopStage:@"report"];
+
+    return YES;
+}
+
+static void print_index_entry(ReferenceIndex *index, ReferenceIndexEntry *entry) {
+    NSMutableString *line = [NSMutableString stringWithFormat:@"%@:%ld: %@",
+                             entry.referencePath, entry.lineNumber, entry.resourcePath];
+    if (entry.isMissing) {
+        [line appendString:@" (missing)"];
+    }
+    // only tell runs apart when there is more than one
+    if (index.runCount > 1) {
+        [line appendFormat:@" [%@]", entry.runName];
+    }
+    fprintf(stdout, "%s\n", line.UTF8String);
+}
+
+// answer references to or by path from index at indexPath
+static int query_index(NSString *indexPath, NSString *referencesToPath,
+                       NSString *referencedByPath) {
+    NSError *error = nil;
+    ReferenceIndex *index = [ReferenceIndex indexWithContentsOfFile:indexPath error:&error];
+    if (index == nil) {
+        print_error(@"Failed to read index %@: %@", indexPath, error.localizedDescription);
+        return EXIT_FAILURE;
+    }
+
+    if (referencesToPath != nil) {
+        NSArray *entries = [index referencesToPath:referencesToPath];
+        NSMutableSet *referencedPaths = [NSMutableSet set];
+        for (ReferenceIndexEntry *entry in entries) {
+            print_index_entry(index, entry);
+            [referencedPaths addObject:entry.resourcePath];
+        }
+
+        NSArray *bundlePaths = [index bundleResourcesMatchingPath:referencesToPath];
+        for (NSString *bundlePath in bundlePaths) {
+            if (![referencedPaths containsObject:bundlePath]) {
+                fprintf(stdout, "%s: not referenced\n", bundlePath.UTF8String);
+            }
+        }
+
+        if (entries.count == 0 && bundlePaths.count == 0) {
+            print_error(@"No resource or reference matching \"%@\" in index.", referencesToPath);
+            return EXIT_FAILURE;
+        }
+    } else {
+        NSArray *entries = [index referencesByPath:referencedByPath];
+        for (ReferenceIndexEntry *entry in entries) {
+            print_index_entry(index, entry);
+        }
+
+        if (entries.count == 0) {
+            print_error(@"No references by \"%@\" in index.", referencedByPath);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// add @[PBXProject, PBXNativeTarget] pairs to lint from workspace
+static BOOL add_workspace_targets(NSString *workspacePath,
+                                  NSString *schemeName,
+                                  BOOL allTargets,
+                                  NSArray *targetNames,
+                                  NSMutableArray *projectTargets) {
+    NSError *error = nil;
+    XCWorkspace *workspace = [XCWorkspace workspaceFromPath:workspacePath
+                                                      error:&error];
+    if (workspace == nil || ![workspace loadProjects:&error]) {
+        print_error(@"Failed to read %@: %@", workspacePath, error.localizedDescription);
+        return NO;
+    }
+
+    if (schemeName != nil) {
+        NSArray *buildableReferences = [workspace buildableReferencesForSchemeNamed:schemeName
+                                                                              error:&error];
+        if (buildableReferences == nil) {
+            print_error(@"%@: %@", workspacePath, error.localizedDescription);
+            print_error(@"Suggested schemes: %@",
+                        [[workspace schemeNames] componentsJoinedByString:@", "]);
+            return NO;
+        }
+
+        for (XCSchemeBuildableReference *buildableReference in buildableReferences) {
+            PBXProject *pbxProject = workspace.projects[buildableReference.projectPath];
+            if (pbxProject == nil) {
+                print_error(@"Scheme \"%@\" builds %@ which is not in the workspace.",
+                            schemeName, buildableReference.projectPath);
+                return NO;
+            }
+
+            // skip aggregate and other non-native targets
+            PBXNativeTarget *nativeTarget = [pbxProject nativeTargetNamed:
+                                             buildableReference.targetName];
+            if (nativeTarget != nil) {
+                [projectTargets addObject:@[pbxProject, nativeTarget]];
+            }
+        }
+    } else if (allTargets || targetNames.count > 0) {
+        for (NSString *projectPath in workspace.projectPaths) {
+            PBXProject *pbxProject = workspace.projects[projectPath];
+            for (PBXNativeTarget *nativeTarget in [pbxProject nativeTargets]) {
+                if (allTargets || [targetNames containsObject:nativeTarget.name]) {
+                    [projectTargets addObject:@[pbxProject, nativeTarget]];
+                }
+            }
+        }
+    } else {
+        print_error(@"No scheme or target given for workspace.");
+        print_error(@"Suggested schemes: %@",
+                    [[workspace schemeNames] componentsJoinedByString:@", "]);
+        return NO;
+    }
+
+    if (projectTargets.count == 0) {
+        print_error(@"No native targets found in workspace.");
+        return NO;
+    }
+
+    return YES;
+}
+
+static int respect_main(int argc,  char *const argv[]) {
     char *argv0 = argv[0];
     NSString *configPath = nil;
     BOOL parseDefaultConfig = YES;
     BOOL dumpConfig = NO;
     NSString *spFeaturesPath = NULL;
+    NSString *timingsPath = nil;
+    BOOL allTargets = NO;
+    NSMutableArray *optionTargetNames = [NSMutableArray array];
+    NSMutableArray *optionConfigurationNames = [NSMutableArray array];
+    NSString *schemeName = nil;
+    ResourceLinterOptions linterOptions = ResourceLinterOptionNone;
+    NSString *sizesPath = nil;
+    NSString *shardString = nil;
+    NSString *shardOutputPath = nil;
+    BOOL merge = NO;
+    BOOL query = NO;
+    NSString *indexPath = nil;
+    NSString *referencesToPath = nil;
+    NSString *referencedByPath = nil;
+
+    // "respect merge ..." combines shard results instead of linting and
+    // "respect query ..." looks up references in an index
+    if (argc > 1 && strcmp(argv[1], "merge") == 0) {
+        merge = YES;
+        argc--;
+        argv++;
+    } else if (argc > 1 && strcmp(argv[1], "query") == 0) {
+        query = YES;
+        argc--;
+        argv++;
+    }
 
     static struct option longopts[] = {
         {"help", no_argument, NULL, 'h'},
@@ -66,11 +317,25 @@ int main(int argc,  char *const argv[]) {
         {"nodefault", no_argument, NULL, 'n'},
         {"dumpconfig", no_argument, NULL, 'd'},
         {"spfeatures", required_argument, NULL, 's'},
+        {"timings", required_argument, NULL, 't'},
+        {"all-targets", no_argument, NULL, 'a'},
+        {"target", required_argument, NULL, 'T'},
+        {"configuration", required_argument, NULL, 'C'},
+        {"scheme", required_argument, NULL, 'S'},
+        {"duplicates", no_argument, NULL, 'D'},
+        {"image-sizes", no_argument, NULL, 'I'},
+        {"sizes", no_argument, NULL, 'Z'},
+        {"sizes-output", required_argument, NULL, 'O'},
+        {"shard", required_argument, NULL, 'H'},
+        {"shard-output", required_argument, NULL, 'W'},
+        {"index", required_argument, NULL, 'X'},
+        {"references-to", required_argument, NULL, 'R'},
+        {"referenced-by", required_argument, NULL, 'B'},
         {NULL, 0, NULL, 0}
     };
 
     int c;
-    while ((c = getopt_long(argc, argv, "hc:nds:", longopts, NULL)) != -1) {
+    while ((c = getopt_long(argc, argv, "hc:nds:t:a", longopts, NULL)) != -1) {
         if (c == 'h') {
             help(argv0);
             return EXIT_SUCCESS;
@@ -82,6 +347,35 @@ int main(int argc,  char *const argv[]) {
             dumpConfig = YES;
         } else if (c == 's') {
             spFeaturesPath = @(optarg);
+        } else if (c == 't') {
+            timingsPath = @(optarg);
+        } else if (c == 'a') {
+            allTargets = YES;
+        } else if (c == 'T') {
+            [optionTargetNames addObject:@(optarg)];
+        } else if (c == 'C') {
+            [optionConfigurationNames addObject:@(optarg)];
+        } else if (c == 'S') {
+            schemeName = @(optarg);
+        } else if (c == 'D') {
+            linterOptions |= ResourceLinterOptionDuplicateContent;
+        } else if (c == 'I') {
+            linterOptions |= ResourceLinterOptionImageSizes;
+        } else if (c == 'Z') {
+            linterOptions |= ResourceLinterOptionBundleSizes;
+        } else if (c == 'O') {
+            linterOptions |= ResourceLinterOptionBundleSizes;
+            sizesPath = @(optarg);
+        } else if (c == 'H') {
+            shardString = @(optarg);
+        } else if (c == 'W') {
+            shardOutputPath = @(optarg);
+        } else if (c == 'X') {
+            indexPath = @(optarg);
+        } else if (c == 'R') {
+            referencesToPath = @(optarg);
+        } else if (c == 'B') {
+            referencedByPath = @(optarg);
         } else {
             return EXIT_FAILURE;
         }
@@ -90,6 +384,16 @@ int main(int argc,  char *const argv[]) {
     argc -= optind;
     argv += optind;
 
+    if (query) {
+        if (indexPath == nil || argc > 0 ||
+            (referencesToPath == nil) == (referencedByPath == nil)) {
+            help(argv0);
+            return EXIT_FAILURE;
+        }
+
+        return query_index(indexPath, referencesToPath, referencedByPath);
+    }
+
     // try to get configuration from env
     NSDictionary *env = [NSProcessInfo processInfo].environment;
     NSString *xcodeProjectPath = env[@"PROJECT_FILE_PATH"];
@@ -104,6 +408,42 @@ int main(int argc,  char *const argv[]) {
         lintReportClass = [ResourceLinterConfigReport class];
     }
 
+    // shard results to merge, lint same project, targets and configurations
+    // as the shards did but use their results instead of matching
+    NSArray *mergeShardResults = nil;
+    if (merge) {
+        if (argc == 0 || shardString != nil) {
+            help(argv0);
+            return EXIT_FAILURE;
+        }
+
+        NSMutableArray *shardResultPaths = [NSMutableArray array];
+        for (int i = 0; i < argc; i++) {
+            [shardResultPaths addObject:@(argv[i])];
+        }
+        NSError *mergeError = nil;
+        mergeShardResults = [ShardResult shardResultsWithContentsOfFiles:shardResultPaths
+                                                                   error:&mergeError];
+        if (mergeShardResults == nil) {
+            print_error(@"Failed to read shard results: %@", mergeError.localizedDescription);
+            return EXIT_FAILURE;
+        }
+
+        ShardResult *firstShardResult = mergeShardResults[0];
+        xcodeProjectPath = firstShardResult.projectPath;
+        [optionTargetNames removeAllObjects];
+        [optionConfigurationNames removeAllObjects];
+        for (NSDictionary *run in firstShardResult.runs) {
+            if (![optionTargetNames containsObject:run[@"target"]]) {
+                [optionTargetNames addObject:run[@"target"]];
+            }
+            if (![optionConfigurationNames containsObject:run[@"configuration"]]) {
+                [optionConfigurationNames addObject:run[@"configuration"]];
+            }
+        }
+        argc = 0;
+    }
+
     if (argc > 0) {
         xcodeProjectPath = @(argv[0]);
     } else if (xcodeProjectPath == nil) {
@@ -112,79 +452,196 @@ int main(int argc,  char *const argv[]) {
     }
 
     if (argc > 1) {
+        if (optionTargetNames.count > 0) {
+            print_error(@"Target \"%s\" given both as argument and with --target", argv[1]);
+            return EXIT_FAILURE;
+        }
         targetName = @(argv[1]);
     }
 
     if (argc > 2) {
+        if (optionConfigurationNames.count > 0) {
+            print_error(@"Configuration \"%s\" given both as argument and with --configuration",
+                        argv[2]);
+            return EXIT_FAILURE;
+        }
         configurationName = @(argv[2]);
     }
 
-    NSError *error = nil;
-    PBXProject *pbxProject = [PBXProject pbxProjectFromPath:xcodeProjectPath
-                                                      error:&error];
-    if (pbxProject == nil) {
-        print_error(@"Failed to read %@: %@", xcodeProjectPath, error.localizedDescription);
-        return EXIT_FAILURE;
+    ShardResult *shardResult = nil;
+    if (shardString != nil) {
+        NSUInteger shardIndex = 0;
+        NSUInteger shardCount = 0;
+        if (![ShardResult parseShardString:shardString
+                                shardIndex:&shardIndex
+                                shardCount:&shardCount]) {
+            print_error(@"Invalid shard \"%@\", should be i/N where i is 0 to N-1", shardString);
+            return EXIT_FAILURE;
+        }
+        if (shardOutputPath == nil) {
+            print_error(@"--shard requires --shard-output");
+            return EXIT_FAILURE;
+        }
+        if (linterOptions & ResourceLinterOptionBundleSizes) {
+            print_error(@"--sizes and --sizes-output are only used when merging shard results");
+            return EXIT_FAILURE;
+        }
+
+        // absolute so that merge works from any directory
+        NSString *currentDirectory = [[NSFileManager defaultManager] currentDirectoryPath];
+        NSString *shardProjectPath = [xcodeProjectPath
+                                      respect_stringByResolvingPathRealtiveTo:currentDirectory];
+        shardResult = [[ShardResult alloc] initWithShardIndex:shardIndex
+                                                   shardCount:shardCount
+                                                  projectPath:shardProjectPath.stringByStandardizingPath];
     }
 
-    NSArray *nativeTargetNames = [pbxProject nativeTargetNames];
-    if (targetName == nil) {
-        if (nativeTargetNames.count == 0) {
-            print_error(@"No native targets found in project file.");
+    StageTimings *timings = [StageTimings sharedTimings];
+    NSError *error = nil;
+    // array of @[PBXProject, PBXNativeTarget] to lint
+    NSMutableArray *projectTargets = [NSMutableArray array];
+    NSArray *targetNames = (optionTargetNames.count > 0 ?
+                            optionTargetNames :
+                            (targetName != nil ? @[targetName] : @[]));
+    BOOL isWorkspace = [xcodeProjectPath.stringByStandardizingPath.pathExtension
+                        isEqualToString:@"xcworkspace"];
+
+    [timings startStage:@"project"];
+    if (isWorkspace) {
+        if (!add_workspace_targets(xcodeProjectPath, schemeName, allTargets,
+                                   targetNames, projectTargets)) {
             return EXIT_FAILURE;
         }
-
-        targetName = nativeTargetNames[0];
     } else {
-        if (![nativeTargetNames containsObject:targetName]) {
-            print_error(@"No native target named \"%@\" found.", targetName);
-            print_error(@"Suggested targets: %@",
-                        [nativeTargetNames componentsJoinedByString:@", "]);
+        PBXProject *pbxProject = [PBXProject pbxProjectFromPath:xcodeProjectPath
+                                                          error:&error];
+        if (pbxProject == nil) {
+            print_error(@"Failed to read %@: %@", xcodeProjectPath, error.localizedDescription);
             return EXIT_FAILURE;
         }
-    }
 
-    PBXNativeTarget *nativeTarget = [pbxProject nativeTargetNamed:targetName];
-    XCBuildConfiguration *buildConfiguration = [nativeTarget configurationNamed:configurationName];
-    if (buildConfiguration == nil) {
-        NSArray *configurationNames = [nativeTarget configurationNames];
-        print_error(@"No configuration named \"%@\" found for native target \"%@\".",
-                    configurationName, targetName);
-        print_error(@"Suggested configurations: %@",
-                    [configurationNames componentsJoinedByString:@", "]);
-        return EXIT_FAILURE;
+        NSArray *nativeTargetNames = [pbxProject nativeTargetNames];
+        if (allTargets) {
+            targetNames = nativeTargetNames;
+        } else if (targetNames.count == 0 && nativeTargetNames.count > 0) {
+            targetNames = @[nativeTargetNames[0]];
+        }
+
+        if (targetNames.count == 0) {
+            print_error(@"No native targets found in project file.");
+            return EXIT_FAILURE;
+        }
+
+        for (NSString *name in targetNames) {
+            if (![nativeTargetNames containsObject:name]) {
+                print_error(@"No native target named \"%@\" found.", name);
+                print_error(@"Suggested targets: %@",
+                            [nativeTargetNames componentsJoinedByString:@", "]);
+                return EXIT_FAILURE;
+            }
+
+            [projectTargets addObject:@[pbxProject, [pbxProject nativeTargetNamed:name]]];
+        }
     }
+    [timings stopStage:@"project"];
+
+    NSArray *configurationNames = (optionConfigurationNames.count > 0 ?
+                                   optionConfigurationNames :
+                                   @[configurationName]);
+    BOOL severalRuns = projectTargets.count * configurationNames.count > 1;
+    // source files and headers shared between targets and projects are only
+    // read once
+    TextFileCache *textFileCache = [[TextFileCache alloc] init];
+    // project path is key, value is LintSession
+    NSMutableDictionary *sessions = [NSMutableDictionary dictionary];
+    // BundleSizeStats for each target and configuration
+    NSMutableArray *sizeStats = [NSMutableArray array];
+    // shards don't know all references, the index is updated when merging
+    ReferenceIndexWriter *indexWriter = (indexPath != nil && shardResult == nil ?
+                                         [[ReferenceIndexWriter alloc] init] :
+                                         nil);
+
+    for (NSArray *projectTarget in projectTargets) {
+        PBXProject *pbxProject = projectTarget[0];
+        PBXNativeTarget *nativeTarget = projectTarget[1];
+        LintSession *session = sessions[[pbxProject projectPath]];
+        if (session == nil) {
+            session = [[LintSession alloc] initWithPBXProject:pbxProject
+                                                textFileCache:textFileCache];
+            sessions[[pbxProject projectPath]] = session;
+        }
+
+        for (NSString *runConfigurationName in configurationNames) {
+            XCBuildConfiguration *buildConfiguration = [nativeTarget
+                                                        configurationNamed:runConfigurationName];
+            if (buildConfiguration == nil) {
+                print_error(@"No configuration named \"%@\" found for native target \"%@\".",
+                            runConfigurationName, nativeTarget.name);
+                print_error(@"Suggested configurations: %@",
+                            [[nativeTarget configurationNames] componentsJoinedByString:@", "]);
+                return EXIT_FAILURE;
+            }
+
+            // Xcode exports build settings for the target and configuration
+            // being built, only use them when linting that one
+            NSDictionary *runEnv = env;
+            NSString *header = nil;
+            if (severalRuns) {
+                if (!([nativeTarget.name isEqualToString:env[@"TARGET_NAME"]] &&
+                      [runConfigurationName isEqualToString:env[@"CONFIGURATION"]])) {
+                    runEnv = nil;
+                }
+
+                header = (isWorkspace ?
+                          [NSString stringWithFormat:
+                           @"Project \"%@\" target \"%@\" configuration \"%@\":",
+                           [pbxProject projectName], nativeTarget.name, runConfigurationName] :
+                          [NSString stringWithFormat:
+                           @"Target \"%@\" configuration \"%@\":",
+                           nativeTarget.name, runConfigurationName]);
+            }
 
+            // linter, matchers and per target temporaries are released before
+            // next run, only the text file cache and size stats are kept
+            BOOL linted = NO;
+            @autoreleasepool {
+                linted = lint_target(session, nativeTarget, buildConfiguration, runEnv,
+                                     header, lintReportClass, configPath, parseDefaultConfig,
+                                     linterOptions, spFeaturesPath, sizeStats,
+                                     shardResult, mergeShardResults, indexWriter);
+            }
+            if (!linted) {
+                return EXIT_FAILURE;
+            }
+        }
+    }
 
-    // prepare sets up fallback build environment used if a variable can't be found in
-    // the normal environment which normally is based on the current process environment.
-    // this it to support running from CLI where Xcode has not exported things for us.
-    // prepare also takes care of loading xcconfig files.
-    if (![pbxProject prepareWithEnvironment:env
-                               nativeTarget:nativeTarget
-                         buildConfiguration:buildConfiguration
-                                      error:&error]) {
-        print_error(@"%@: %@", xcodeProjectPath, error.localizedDescription);
+    if (shardResult != nil && ![shardResult writeToPath:shardOutputPath error:&error]) {
+        print_error(@"Failed to write shard result to %@: %@", shardOutputPath,
+                    error.localizedDescription);
         return EXIT_FAILURE;
     }
 
-    ResourceLinterXcodeProjectSource *projectSource = [[ResourceLinterXcodeProjectSource alloc]
-                                                       initWithPBXProject:pbxProject
-                                                       nativeTarget:nativeTarget
-                                                       buildConfiguration:buildConfiguration];
-    if (spFeaturesPath != nil) {
-        [projectSource addSpotifyFeaturesAtPath:spFeaturesPath];
+    if (indexWriter != nil && ![indexWriter updateIndexAtPath:indexPath error:&error]) {
+        print_error(@"Failed to write index to %@: %@", indexPath, error.localizedDescription);
+        return EXIT_FAILURE;
     }
 
-    ResourceLinter *linter = [[ResourceLinter alloc]
-                              initWithResourceLinterSource:projectSource
-                              configPath:configPath
-                              parseDefaultConfig:parseDefaultConfig];
+    if (sizesPath != nil && ![BundleSizeStats writeStats:sizeStats toPath:sizesPath error:&error]) {
+        print_error(@"Failed to write sizes to %@: %@", sizesPath, error.localizedDescription);
+        return EXIT_FAILURE;
+    }
 
-    ResourceLinterAbstractReport *lintReport = [[lintReportClass alloc]
-                                                initWithLinter:linter];
+    if (timingsPath != nil && ![timings writeToPath:timingsPath error:&error]) {
+        print_error(@"Failed to write timings to %@: %@", timingsPath, error.localizedDescription);
+        return EXIT_FAILURE;
+    }
 
-    fprintf(stdout, "%s", (lintReport.outputBuffer).UTF8String);
-    
     return EXIT_SUCCESS;
 }
+
+int main(int argc,  char *const argv[]) {
+    @autoreleasepool {
+        return respect_main(argc, argv);
+    }
+}
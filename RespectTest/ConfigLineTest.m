@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "ConfigLineTest.h"
+#import "ConfigLine.h"
+#import "TextFile.h"
+
+@implementation ConfigLineTest
+
+- (void)testConfigLinesInTextFile {
+    TextFile *textFile = [TextFile
+                          textFileWithText:
+                          @"no config here\n"
+                          @"// @Lint-like text then @LintImage: a.png\n"
+                          @"\n"
+                          @"  @LintIgnoreMissingDefault: b\n"
+                          @"@LintFile c.txt"
+                          path:@"test.m"];
+    NSArray *configLines = [ConfigLine configLinesInTextFile:textFile];
+
+    XCTAssertEqual(configLines.count, (NSUInteger)3, @"");
+
+    ConfigLine *configLine = configLines[0];
+    XCTAssertEqualObjects(configLine.file, @"test.m", @"");
+    XCTAssertEqual(configLine.textLocation.lineNumber, (NSUInteger)2, @"");
+    XCTAssertEqual(configLine.textLocation.inLineRange.location, (NSUInteger)25, @"");
+    XCTAssertEqualObjects(configLine.name, @"Image", @"");
+    XCTAssertFalse(configLine.isDefault, @"");
+    XCTAssertEqualObjects(configLine.separator, @":", @"");
+    XCTAssertEqualObjects(configLine.argument, @"a.png", @"");
+
+    configLine = configLines[1];
+    XCTAssertEqual(configLine.textLocation.lineNumber, (NSUInteger)4, @"");
+    XCTAssertEqual(configLine.textLocation.inLineRange.location, (NSUInteger)3, @"");
+    XCTAssertEqualObjects(configLine.name, @"IgnoreMissing", @"");
+    XCTAssertTrue(configLine.isDefault, @"");
+    XCTAssertEqualObjects(configLine.argument, @"b", @"");
+
+    configLine = configLines[2];
+    XCTAssertEqual(configLine.textLocation.lineNumber, (NSUInteger)5, @"");
+    XCTAssertEqualObjects(configLine.name, @"File", @"");
+    XCTAssertEqualObjects(configLine.separator, @" ", @"");
+    XCTAssertEqualObjects(configLine.argument, @"c.txt", @"");
+
+    XCTAssertEqual([ConfigLine configLinesInTextFile:
+                    [TextFile textFileWithText:@"" path:@""]].count,
+                   (NSUInteger)0, @"");
+}
+
+- (void)testConfigLinesFromEntries {
+    static const ConfigLineEntry entries[] = {
+        {1, 1, 20, "ResourceMatch", NO, "/a$(EXT)/"},
+        {2, 1, 20, "Warning", NO, "$1"},
+    };
+    NSArray *configLines = [ConfigLine configLinesFromEntries:entries
+                                                        count:2
+                                                         file:@"test.config"
+                                                    variables:@{@"EXT": @"png"}];
+
+    XCTAssertEqual(configLines.count, (NSUInteger)2, @"");
+    XCTAssertEqualObjects([configLines[0] argument], @"/apng/", @"");
+    XCTAssertEqualObjects([configLines[1] argument], @"$1", @"");
+    XCTAssertEqual([configLines[1] textLocation].lineNumber, (NSUInteger)2, @"");
+}
+
+@end
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "DuplicateContentFinderTest.h"
+#import "DuplicateContentFinder.h"
+#import "BundleResource.h"
+#import "TestTemporaryDirectory.h"
+
+@implementation DuplicateContentFinderTest
+
+- (void)testDuplicateGroups {
+    TestTemporaryDirectory *tmp = [TestTemporaryDirectory temporaryDirectory];
+
+    NSDictionary *contents = @{@"a": @"same content",
+                               @"b": @"same content",
+                               @"c": @"same-content",
+                               @"d": @"other",
+                               @"e": @""};
+    PathTable *pathTable = [[PathTable alloc] init];
+    NSMutableArray *resources = [NSMutableArray array];
+    for (NSString *name in contents) {
+        NSString *path = [tmp writeString:contents[name] toName:name];
+        [resources addObject:[[BundleResource alloc]
+                              initWithBuildSourcePath:path
+                              path:[name stringByAppendingString:@".png"]
+                              pathTable:pathTable]];
+    }
+    // same source copied to two bundle paths
+    [resources addObject:[[BundleResource alloc]
+                          initWithBuildSourcePath:[tmp pathForName:@"d"]
+                          path:@"d2.png"
+                          pathTable:pathTable]];
+    // empty files are not reported
+    [resources addObject:[[BundleResource alloc]
+                          initWithBuildSourcePath:[tmp pathForName:@"e"]
+                          path:@"e2.png"
+                          pathTable:pathTable]];
+
+    NSArray *groups = [DuplicateContentFinder duplicateGroupsInBundleResources:resources];
+    XCTAssertEqual(groups.count, (NSUInteger)2, @"");
+    XCTAssertEqualObjects([groups[0] valueForKey:@"path"], (@[@"a.png", @"b.png"]), @"");
+    XCTAssertEqualObjects([groups[1] valueForKey:@"path"], (@[@"d.png", @"d2.png"]), @"");
+
+    [tmp remove];
+}
+
+@end
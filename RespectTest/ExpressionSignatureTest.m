@@ -18,6 +18,21 @@
 #import "ExpressionSignatureTest.h"
 #import "ExpressionSignature.h"
 
+static NSArray *ExpressionSignatureTokenMatches(id<ExpressionSignature> exp,
+                                               NSString *test) {
+    NSMutableArray *matchedStrings = [NSMutableArray array];
+    [ExpressionSignature
+     enumerateMatchesOfSignature:exp
+     inSourceTokens:[[SourceTokens alloc] initWithString:test]
+     usingBlock:^(NSRange range, NSArray *captureRanges, BOOL *stop) {
+         for (NSValue *captureRange in captureRanges) {
+             [matchedStrings addObject:[test substringWithRange:captureRange.rangeValue]];
+         }
+     }];
+
+    return matchedStrings;
+}
+
 static BOOL ExpressionSignatureTestCase(NSString *signature,
                                         NSArray *expectedStrings,
                                         NSArray *tests) {
@@ -33,6 +48,9 @@ static BOOL ExpressionSignatureTestCase(NSString *signature,
         return NO;
     }
 
+    id<ExpressionSignature> exp = [ExpressionSignature signatureFromString:signature
+                                                                    error:&error];
+
     for (NSString *test in tests) {
         NSMutableArray *matchedStrings = [NSMutableArray array];
         for (NSTextCheckingResult *result in [re matchesInString:test
@@ -46,6 +64,11 @@ static BOOL ExpressionSignatureTestCase(NSString *signature,
         if (![expectedStrings isEqual:matchedStrings]) {
             return NO;
         }
+
+        // structural token matcher should capture the same strings
+        if (![expectedStrings isEqual:ExpressionSignatureTokenMatches(exp, test)]) {
+            return NO;
+        }
     }
 
     return YES;
@@ -146,4 +169,39 @@ static BOOL ExpressionSignatureTestCase(NSString *signature,
 
     XCTAssertTrue(ExpressionSignatureTestCase(@"p(@) trailing", nil, nil));
 }
+
+- (void)testExpressionSignatureTokenMatcher {
+    NSError *error = nil;
+    id<ExpressionSignature> exp = nil;
+
+    // skip argument stops at next parameter on same nesting level
+    exp = [ExpressionSignature signatureFromString:@"[a b: c:@]" error:&error];
+    XCTAssertEqualObjects(ExpressionSignatureTokenMatches(exp, @"[a b:[x c:@\"no\"] c:@\"yes\"]"),
+                          @[@"yes"]);
+    // brackets and parentheses in strings and char literals are not structure
+    XCTAssertEqualObjects(ExpressionSignatureTokenMatches(exp, @"[a b:f(\"]\", ']') c:@\"yes\"]"),
+                          @[@"yes"]);
+    // skip do not continue past end of statement
+    XCTAssertEqualObjects(ExpressionSignatureTokenMatches(exp, @"[a b:x; c:@\"no\"]"),
+                          @[]);
+    // inner send is found if outer do not match
+    exp = [ExpressionSignature signatureFromString:@"[a b:@]" error:&error];
+    XCTAssertEqualObjects(ExpressionSignatureTokenMatches(exp, @"[x y:[a b:@\"inner\"]]"),
+                          @[@"inner"]);
+    // unbalanced source
+    XCTAssertEqualObjects(ExpressionSignatureTokenMatches(exp, @"[a b:@\"a\" ] ] [a b:@\"b\""),
+                          @[@"a"]);
+
+    // nested send with skip arguments on long line with a big literal array
+    // used to backtrack heavily with the regex translation
+    NSMutableString *test = [NSMutableString stringWithString:@"[[[x a:@[ "];
+    for (NSUInteger i = 0; i < 20000; i++) {
+        [test appendFormat:@"@\"%lu\", [y z:%lu], ", (unsigned long)i, (unsigned long)i];
+    }
+    [test appendString:@"]] b:q] d:@\"end\"]"];
+    exp = [ExpressionSignature signatureFromString:@"[[[x a:] b:] c:@]" error:&error];
+    XCTAssertEqualObjects(ExpressionSignatureTokenMatches(exp, test), @[]);
+    exp = [ExpressionSignature signatureFromString:@"[[[x a:] b:] d:@]" error:&error];
+    XCTAssertEqualObjects(ExpressionSignatureTokenMatches(exp, test), @[@"end"]);
+}
 @end
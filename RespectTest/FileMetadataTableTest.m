@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "FileMetadataTableTest.h"
+#import "FileMetadataTable.h"
+#import "TestTemporaryDirectory.h"
+
+@implementation FileMetadataTableTest
+
+- (void)testPrefetchedAndNotPrefetched {
+    TestTemporaryDirectory *tmp = [TestTemporaryDirectory temporaryDirectory];
+    NSString *dir = tmp.path;
+    NSString *file = [tmp writeString:@"abc" toName:@"a.txt"];
+    NSString *missing = [tmp pathForName:@"missing.txt"];
+
+    FileMetadataTable *table = [[FileMetadataTable alloc] init];
+    [table prefetchPaths:@[dir, file, file, missing]];
+
+    BOOL isDir = NO;
+    XCTAssertTrue([table fileExistsAtPath:dir isDirectory:&isDir], @"");
+    XCTAssertTrue(isDir, @"");
+    XCTAssertTrue([table fileExistsAtPath:file isDirectory:&isDir], @"");
+    XCTAssertFalse(isDir, @"");
+    XCTAssertTrue([table isReadableFileAtPath:file], @"");
+    XCTAssertEqual([table fileSizeAtPath:file], 3ULL, @"");
+    XCTAssertEqual([table fileSizeAtPath:dir], 0ULL, @"");
+    XCTAssertFalse([table fileExistsAtPath:missing isDirectory:NULL], @"");
+    XCTAssertFalse([table isReadableFileAtPath:missing], @"");
+
+    // prefetched metadata is kept even if file changes
+    [[NSFileManager defaultManager] removeItemAtPath:file error:NULL];
+    XCTAssertTrue([table fileExistsAtPath:file isDirectory:NULL], @"");
+
+    // not prefetched is stat:ed on demand
+    XCTAssertFalse([table fileExistsAtPath:[tmp pathForName:@"b"]
+                               isDirectory:NULL], @"");
+    XCTAssertFalse([table fileExistsAtPath:nil isDirectory:NULL], @"");
+
+    [tmp remove];
+}
+
+@end
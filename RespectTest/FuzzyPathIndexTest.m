@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "FuzzyPathIndexTest.h"
+#import "FuzzyPathIndex.h"
+
+@implementation FuzzyPathIndexTest
+
+- (void)testBoundedEditDistance {
+    unichar a[] = {'k', 'i', 't', 't', 'e', 'n'};
+    unichar b[] = {'s', 'i', 't', 't', 'i', 'n', 'g'};
+    NSUInteger rows[2 * (7 + 2)];
+
+    XCTAssertEqual(RespectBoundedEditDistance(a, 6, b, 7, 7, rows), (NSUInteger)3, @"");
+    XCTAssertEqual(RespectBoundedEditDistance(a, 6, b, 7, 3, rows), (NSUInteger)3, @"");
+    XCTAssertEqual(RespectBoundedEditDistance(a, 6, b, 7, 2, rows), (NSUInteger)3, @"");
+    XCTAssertEqual(RespectBoundedEditDistance(a, 6, b, 7, 0, rows), (NSUInteger)1, @"");
+    XCTAssertEqual(RespectBoundedEditDistance(a, 6, a, 6, 0, rows), (NSUInteger)0, @"");
+    XCTAssertEqual(RespectBoundedEditDistance(a, 0, b, 7, 7, rows), (NSUInteger)7, @"");
+}
+
+- (void)testPathsNearPath {
+    FuzzyPathIndex *index = [[FuzzyPathIndex alloc] initWithPaths:
+                             @[@"images/btn-close.png",
+                               @"images/btn-close@2x.png",
+                               @"images/btn-open.png",
+                               @"images/Btn_Closed.png",
+                               @"sounds/click.caf",
+                               @"sounds/click.caf"]];
+    XCTAssertEqual(index.count, (NSUInteger)6, @"");
+
+    XCTAssertEqualObjects([index pathsNearPath:@"images/btn_close.png" maxDistance:0], @[], @"");
+    XCTAssertEqualObjects([index pathsNearPath:@"images/btn_close.png" maxDistance:1],
+                          (@[@"images/Btn_Closed.png", @"images/btn-close.png"]), @"");
+    XCTAssertEqualObjects([index pathsNearPath:@"images/btn_close.png" maxDistance:4],
+                          (@[@"images/Btn_Closed.png", @"images/btn-close.png",
+                             @"images/btn-close@2x.png"]), @"");
+    XCTAssertEqualObjects([index pathsNearPath:@"SOUNDS/CLICK.CAF" maxDistance:0],
+                          (@[@"sounds/click.caf", @"sounds/click.caf"]), @"");
+    XCTAssertEqualObjects([index pathsNearPath:@"other.png" maxDistance:3], @[], @"");
+
+    FuzzyPathIndex *emptyIndex = [[FuzzyPathIndex alloc] initWithPaths:@[]];
+    XCTAssertEqualObjects([emptyIndex pathsNearPath:@"a" maxDistance:1], @[], @"");
+}
+
+@end
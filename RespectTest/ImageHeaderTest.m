@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ImageHeaderTest.h"
+#import "ImageHeader.h"
+
+@implementation ImageHeaderTest
+
+- (void)assertBytes:(const uint8_t *)bytes
+             length:(NSUInteger)length
+              width:(NSUInteger)width
+             height:(NSUInteger)height {
+    ImageHeader *imageHeader = [ImageHeader imageHeaderWithBytes:bytes length:length];
+    XCTAssertNotNil(imageHeader, @"");
+    XCTAssertEqual(imageHeader.pixelWidth, width, @"");
+    XCTAssertEqual(imageHeader.pixelHeight, height, @"");
+}
+
+- (void)testPNG {
+    const uint8_t png[] = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n',
+        0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        0, 0, 1, 0x2c, 0, 0, 0, 0xc8
+    };
+    [self assertBytes:png length:sizeof(png) width:300 height:200];
+
+    const uint8_t crushedPNG[] = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n',
+        0, 0, 0, 4, 'C', 'g', 'B', 'I', 0x50, 0, 0x20, 0x06, 0, 0, 0, 0,
+        0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        0, 0, 0, 0x40, 0, 0, 0, 0x20
+    };
+    [self assertBytes:crushedPNG length:sizeof(crushedPNG) width:64 height:32];
+
+    XCTAssertNil([ImageHeader imageHeaderWithBytes:png length:20], @"");
+}
+
+- (void)testGIF {
+    const uint8_t gif[] = {'G', 'I', 'F', '8', '9', 'a', 0x2c, 0x01, 0xc8, 0x00};
+    [self assertBytes:gif length:sizeof(gif) width:300 height:200];
+}
+
+- (void)testJPEG {
+    const uint8_t jpeg[] = {
+        0xff, 0xd8,
+        // APP0 segment
+        0xff, 0xe0, 0, 6, 'J', 'F', 'I', 'F',
+        // DHT segment, has marker in SOF range but is not a frame header
+        0xff, 0xc4, 0, 3, 0,
+        // SOF2
+        0xff, 0xc2, 0, 11, 8, 0, 0xc8, 0x01, 0x2c, 3
+    };
+    [self assertBytes:jpeg length:sizeof(jpeg) width:300 height:200];
+
+    const uint8_t scanFirst[] = {0xff, 0xd8, 0xff, 0xda, 0, 2};
+    XCTAssertNil([ImageHeader imageHeaderWithBytes:scanFirst length:sizeof(scanFirst)], @"");
+}
+
+- (void)testUnknown {
+    XCTAssertNil([ImageHeader imageHeaderWithBytes:(const uint8_t *)"text" length:4], @"");
+    XCTAssertNil([ImageHeader imageHeaderWithBytes:NULL length:0], @"");
+}
+
+@end
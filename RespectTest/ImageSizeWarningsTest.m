@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ImageSizeWarningsTest.h"
+#import "ResourceLinter.h"
+#import "LintWarning.h"
+#import "TestTemporaryDirectory.h"
+
+// only bundle resources, no sources or config
+@interface ImageSizeTestSource : NSObject <ResourceLinterSource>
+@property (nonatomic, readwrite, strong) NSDictionary *sourceTextFiles;
+@property (nonatomic, readwrite, strong) NSDictionary *resources;
+@property (nonatomic, readwrite, strong) NSArray *lintWarnings;
+@property (nonatomic, readwrite, strong) NSArray *lintErrors;
+@property (nonatomic, readwrite, copy) NSString *projectName;
+@property (nonatomic, readwrite, copy) NSString *projectPath;
+@property (nonatomic, readwrite, copy) NSString *sourceRoot;
+@property (nonatomic, readwrite, copy) NSString *targetName;
+@property (nonatomic, readwrite, copy) NSString *configurationName;
+@property (nonatomic, readwrite, copy) NSArray *knownRegions;
+@property (nonatomic, readwrite) ResourceLinterSourceTargetType targetType;
+@property (nonatomic, readwrite, copy) NSString *deploymentTarget;
+@end
+
+@implementation ImageSizeTestSource
+
+- (NSArray *)defaultConfigLines {
+    return @[];
+}
+
+@end
+
+@implementation ImageSizeWarningsTest
+
+- (void)testImageSizeWarnings {
+    TestTemporaryDirectory *tmp = [TestTemporaryDirectory temporaryDirectory];
+
+    // bundle path to @[width, height], written as GIF headers
+    NSDictionary *sizes = @{@"a.gif": @[@10, @10],
+                            // not twice the size of a.gif
+                            @"a@2x.gif": @[@15, @20],
+                            @"b.gif": @[@10, @10],
+                            @"b@2x.gif": @[@20, @20],
+                            @"b@3x.gif": @[@30, @30],
+                            // 1050 points wide
+                            @"c@2x.gif": @[@2100, @10],
+                            @"d~iphone.gif": @[@600, @10],
+                            @"e.gif": @[@1000, @10]};
+    NSMutableDictionary *resources = [NSMutableDictionary dictionary];
+    for (NSString *bundlePath in sizes) {
+        uint16_t width = [sizes[bundlePath][0] unsignedShortValue];
+        uint16_t height = [sizes[bundlePath][1] unsignedShortValue];
+        const uint8_t gif[] = {
+            'G', 'I', 'F', '8', '9', 'a',
+            width & 0xff, width >> 8, height & 0xff, height >> 8
+        };
+        resources[bundlePath] = [tmp writeData:[NSData dataWithBytes:gif length:sizeof(gif)]
+                                        toName:bundlePath];
+    }
+
+    ImageSizeTestSource *linterSource = [[ImageSizeTestSource alloc] init];
+    linterSource.sourceTextFiles = @{};
+    linterSource.resources = resources;
+    linterSource.lintWarnings = @[];
+    linterSource.lintErrors = @[];
+    linterSource.sourceRoot = tmp.path;
+    linterSource.targetType = ResourceLinterSourceTargetTypeIOS;
+    ResourceLinter *linter = [[ResourceLinter alloc]
+                              initWithResourceLinterSource:linterSource
+                              configPath:nil
+                              parseDefaultConfig:NO
+                              options:ResourceLinterOptionImageSizes];
+
+    NSSet *messages = [NSSet setWithArray:[linter.lintWarnings valueForKey:@"message"]];
+    NSSet *expectedMessages = [NSSet setWithArray:
+                               @[@"Bundle path \"a@2x.gif\" is 15x20 pixels, "
+                                 @"expected 20x20 for 10x10 \"a.gif\"",
+                                 @"Bundle path \"c@2x.gif\" is 2100x10 pixels, "
+                                 @"larger than any screen at @2x",
+                                 @"Bundle path \"d~iphone.gif\" is 600x10 pixels, "
+                                 @"larger than any screen at @1x"]];
+    XCTAssertEqualObjects(messages, expectedMessages, @"");
+
+    LintWarning *lintWarning = nil;
+    for (lintWarning in linter.lintWarnings) {
+        if ([lintWarning.message hasPrefix:@"Bundle path \"a@2x.gif\""]) {
+            break;
+        }
+    }
+    XCTAssertEqualObjects(lintWarning.file, resources[@"a@2x.gif"], @"");
+
+    [tmp remove];
+}
+
+@end
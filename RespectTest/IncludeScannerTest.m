@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "IncludeScannerTest.h"
+#import "IncludeScanner.h"
+#import "ScratchArena.h"
+
+@implementation IncludeScannerTest
+
+- (void)testDirectives {
+    NSString *text = (@"#import \"a.h\"\n"
+                      @"  #  include \"b.h\"\n"
+                      @"#import <c.h>\n"
+                      @"x = 1; #import \"d.h\"\n"
+                      @"const char *s = \"/* not comment\";\n"
+                      @"#import \"e/*.h\" // comment\n");
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text honorDefines:NO],
+                          (@[@"a.h", @"b.h", @"e/*.h"]), @"");
+}
+
+- (void)testComments {
+    NSString *text = (@"// #import \"a.h\"\n"
+                      @"/* #import \"b.h\"\n"
+                      @"#import \"c.h\" */\n"
+                      @"#import \"d.h\" /* open\n"
+                      @"#import \"e.h\"\n"
+                      @"*/\n"
+                      @"#import \"f.h\"\n");
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text honorDefines:NO],
+                          (@[@"d.h", @"f.h"]), @"");
+}
+
+- (void)testConditionals {
+    NSString *text = (@"#if 0\n"
+                      @"#import \"a.h\"\n"
+                      @"#if 1\n"
+                      @"#import \"b.h\"\n"
+                      @"#endif\n"
+                      @"#else\n"
+                      @"#import \"c.h\"\n"
+                      @"#endif\n"
+                      @"#if 1\n"
+                      @"#import \"d.h\"\n"
+                      @"#elif SOMETHING\n"
+                      @"#import \"e.h\"\n"
+                      @"#else\n"
+                      @"#import \"f.h\"\n"
+                      @"#endif\n"
+                      @"#if SOMETHING\n"
+                      @"#import \"g.h\"\n"
+                      @"#else\n"
+                      @"#import \"h.h\"\n"
+                      @"#endif\n");
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text honorDefines:NO],
+                          (@[@"c.h", @"d.h", @"g.h", @"h.h"]), @"");
+}
+
+- (void)testHonorDefines {
+    NSString *text = (@"#ifndef A_H\n"
+                      @"#define A_H\n"
+                      @"#endif\n"
+                      @"#ifndef A_H\n"
+                      @"#import \"a.h\"\n"
+                      @"#else\n"
+                      @"#import \"b.h\"\n"
+                      @"#endif\n"
+                      @"#if !defined(A_H)\n"
+                      @"#import \"c.h\"\n"
+                      @"#endif\n"
+                      @"#ifdef UNKNOWN\n"
+                      @"#import \"d.h\"\n"
+                      @"#else\n"
+                      @"#import \"e.h\"\n"
+                      @"#endif\n");
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text honorDefines:YES],
+                          (@[@"b.h", @"d.h", @"e.h"]), @"");
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text honorDefines:NO],
+                          (@[@"a.h", @"b.h", @"c.h", @"d.h", @"e.h"]), @"");
+}
+
+- (void)testDefineInUnknownBranch {
+    NSString *text = (@"#if DEBUG\n"
+                      @"#define USE_X\n"
+                      @"#undef A\n"
+                      @"#else\n"
+                      @"#define USE_Y\n"
+                      @"#endif\n"
+                      @"#ifndef USE_X\n"
+                      @"#import \"Fallback.h\"\n"
+                      @"#endif\n"
+                      @"#if !defined(USE_Y)\n"
+                      @"#import \"b.h\"\n"
+                      @"#endif\n");
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text honorDefines:YES],
+                          (@[@"Fallback.h", @"b.h"]), @"");
+
+    // defined before but maybe undefined in unknown branch
+    text = (@"#define A\n"
+            @"#ifdef DEBUG\n"
+            @"#undef A\n"
+            @"#endif\n"
+            @"#ifndef A\n"
+            @"#import \"a.h\"\n"
+            @"#endif\n"
+            @"#if defined(UNKNOWN)\n"
+            @"#elif 1\n"
+            @"#define B\n"
+            @"#endif\n"
+            @"#ifndef B\n"
+            @"#import \"b.h\"\n"
+            @"#endif\n");
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text honorDefines:YES],
+                          (@[@"a.h", @"b.h"]), @"");
+}
+
+- (void)testScratchArena {
+    ScratchArena *arena = ScratchArenaCreate(16);
+    NSMutableString *text = [NSMutableString stringWithString:@"#import \"\u00e5.h\"\n"];
+    // deeper than initial #if stack
+    for (NSUInteger i = 0; i < 40; i++) {
+        [text appendString:@"#if A\n"];
+    }
+    [text appendString:@"#import \"a.h\"\n"];
+    for (NSUInteger i = 0; i < 40; i++) {
+        [text appendString:@"#endif\n"];
+    }
+
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:text
+                                                       honorDefines:YES
+                                                       scratchArena:arena],
+                          (@[@"\u00e5.h", @"a.h"]), @"");
+    ScratchArenaReset(arena);
+    XCTAssertEqualObjects([IncludeScanner quotedIncludePathsInText:@"#include \"b.h\"\n"
+                                                       honorDefines:YES
+                                                       scratchArena:arena],
+                          (@[@"b.h"]), @"");
+
+    ScratchArenaDestroy(arena);
+}
+
+@end
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "LibrespectTest.h"
+#import "librespect.h"
+#import "TestTemporaryDirectory.h"
+
+@implementation LibrespectTest
+
+- (NSString *)testProjectPath {
+    NSString *testsPath = [NSBundle bundleForClass:[self class]].resourcePath;
+    return [testsPath stringByAppendingPathComponent:@"RespectTestProject"];
+}
+
+- (respect_project *)openProjectInPath:(NSString *)path {
+    NSString *projectPath = [path stringByAppendingPathComponent:
+                             @"RespectTestProject.xcodeproj"];
+    return respect_project_open(projectPath.UTF8String, NULL);
+}
+
+- (respect_project *)openTestProject {
+    return [self openProjectInPath:[self testProjectPath]];
+}
+
+- (NSUInteger)countResults:(const respect_lint *)lint
+                      kind:(respect_result_kind)kind
+              resourcePath:(NSString *)resourcePath {
+    NSUInteger count = 0;
+    for (size_t i = 0; i < respect_lint_result_count(lint); i++) {
+        const respect_result *result = respect_lint_result(lint, i);
+        if (result->kind == kind &&
+            (resourcePath == nil ||
+             (result->resource_path != NULL &&
+              [@(result->resource_path) isEqualToString:resourcePath]))) {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+- (void)testLintTarget {
+    XCTAssertEqual(respect_api_version(), (unsigned int)RESPECT_API_VERSION, @"");
+
+    // copy so that a source can be changed
+    TestTemporaryDirectory *tmp = [TestTemporaryDirectory temporaryDirectory];
+    NSString *projectDir = [tmp pathForName:@"RespectTestProject"];
+    XCTAssertTrue([[NSFileManager defaultManager] copyItemAtPath:[self testProjectPath]
+                                                          toPath:projectDir
+                                                           error:NULL], @"");
+    respect_project *project = [self openProjectInPath:projectDir];
+    XCTAssertTrue(project != NULL, @"");
+
+    NSMutableArray *targetNames = [NSMutableArray array];
+    for (size_t i = 0; i < respect_project_target_count(project); i++) {
+        [targetNames addObject:@(respect_project_target_name(project, i))];
+    }
+    XCTAssertTrue([targetNames containsObject:@"TestImage"], @"");
+    XCTAssertTrue(respect_project_target_name(project, targetNames.count) == NULL, @"");
+
+    respect_lint_options options = {.target_name = "TestImage"};
+    respect_lint *lint = respect_lint_target(project, &options, NULL);
+    XCTAssertTrue(lint != NULL, @"");
+    XCTAssertTrue([self countResults:lint kind:RESPECT_RESULT_MISSING_RESOURCE
+                        resourcePath:@"a.png"] > 0, @"");
+    XCTAssertEqual([self countResults:lint kind:RESPECT_RESULT_UNUSED_RESOURCE
+                         resourcePath:@"d.png"], (NSUInteger)1, @"");
+    size_t resultCount = respect_lint_result_count(lint);
+    XCTAssertTrue(respect_lint_result(lint, resultCount) == NULL, @"");
+    respect_lint_free(lint);
+
+    // remove the config line referencing a.png, missing a*.png should be gone
+    // when linted again after the source is reported changed
+    NSString *testPath = [projectDir stringByAppendingPathComponent:@"TestImage/test.m"];
+    NSString *source = [NSString stringWithContentsOfFile:testPath
+                                                 encoding:NSUTF8StringEncoding
+                                                    error:NULL];
+    NSString *configLine = @"// @LintImage: a @1x @2x ~ipad ~iphone ~any png\n";
+    XCTAssertTrue([source rangeOfString:configLine].location != NSNotFound, @"");
+    source = [source stringByReplacingOccurrencesOfString:configLine withString:@""];
+    XCTAssertTrue([source writeToFile:testPath
+                           atomically:NO
+                             encoding:NSUTF8StringEncoding
+                                error:NULL], @"");
+    const char *firstTargetName = respect_project_target_name(project, 0);
+    const char *changedPaths[] = {testPath.UTF8String};
+    XCTAssertEqual(respect_project_files_changed(project, changedPaths, 1, NULL), 1, @"");
+    // project was not read again so target names are the same strings
+    XCTAssertTrue(respect_project_target_name(project, 0) == firstTargetName, @"");
+    lint = respect_lint_target(project, &options, NULL);
+    XCTAssertTrue(lint != NULL, @"");
+    XCTAssertEqual([self countResults:lint kind:RESPECT_RESULT_MISSING_RESOURCE
+                         resourcePath:@"a.png"], (NSUInteger)0, @"");
+    XCTAssertEqual([self countResults:lint kind:RESPECT_RESULT_UNUSED_RESOURCE
+                         resourcePath:@"d.png"], (NSUInteger)1, @"");
+    XCTAssertTrue(respect_lint_result_count(lint) < resultCount, @"");
+    respect_lint_free(lint);
+
+    respect_project_close(project);
+    [tmp remove];
+}
+
+- (void)testErrors {
+    char *error = NULL;
+    XCTAssertTrue(respect_project_open("/nonexisting.xcodeproj", &error) == NULL, @"");
+    XCTAssertTrue(error != NULL, @"");
+    respect_free(error);
+
+    respect_project *project = [self openTestProject];
+    respect_lint_options options = {.target_name = "nonexisting"};
+    error = NULL;
+    XCTAssertTrue(respect_lint_target(project, &options, &error) == NULL, @"");
+    XCTAssertEqualObjects(@(error), @"No native target named \"nonexisting\" found.", @"");
+    respect_free(error);
+
+    options = (respect_lint_options){
+        .target_name = "TestImage",
+        .configuration_name = "nonexisting"
+    };
+    error = NULL;
+    XCTAssertTrue(respect_lint_target(project, &options, &error) == NULL, @"");
+    XCTAssertTrue(error != NULL, @"");
+    respect_free(error);
+
+    respect_project_close(project);
+}
+
+@end
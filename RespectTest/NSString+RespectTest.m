@@ -331,5 +331,29 @@
     XCTAssertEqualObjects([@"\t\r\n a \n\r\n" respect_stringByTrimmingWhitespace], @"a");
 }
 
+- (void)test_respect_sortKey {
+    NSArray *strings = @[@"a", @"A", @"a1", @"a01", @"a2", @"a10", @"a10b",
+                         @"a_b", @"a-b", @"a/b", @"aB", @"b", @"B1.png",
+                         @"b1@2x.png", @"b10.png", @"1", @"9", @"10", @"Z",
+                         @"_", @"",
+                         // runs longer than fits in a byte
+                         [@"a" stringByPaddingToLength:301 withString:@"9" startingAtIndex:0],
+                         [@"a" stringByPaddingToLength:300 withString:@"9" startingAtIndex:0],
+                         [@"a1" stringByPaddingToLength:300 withString:@"0" startingAtIndex:0],
+                         [@"a" stringByPaddingToLength:256 withString:@"9" startingAtIndex:0],
+                         [@"a" stringByPaddingToLength:255 withString:@"9" startingAtIndex:0]];
+
+    XCTAssertNil([@"\u00e5" respect_sortKey]);
+
+    for (NSString *a in strings) {
+        for (NSString *b in strings) {
+            XCTAssertEqual(RespectCompareUsingSortKeys(a, [a respect_sortKey],
+                                                       b, [b respect_sortKey]),
+                           [a compare:b options:NSCaseInsensitiveSearch|NSNumericSearch],
+                           @"%@ %@", a, b);
+        }
+    }
+}
+
 
 @end
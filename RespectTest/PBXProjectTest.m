@@ -54,4 +54,54 @@
     XCTAssertEqualObjects([nativeTarget configurationNames], expectedConfigurations);
 }
 
+- (void)test_buildPath {
+    NSError *error = nil;
+    PBXProject *pbxProject = [PBXProject
+                              pbxProjectFromPath:
+                              [[NSBundle bundleForClass:[self class]].resourcePath
+                               stringByAppendingPathComponent:@"RespectTestProject/RespectTestProject.xcodeproj"]
+                              error:&error];
+    XCTAssertNotNil(pbxProject, @"");
+
+    PBXNativeTarget *nativeTarget = [pbxProject nativeTargetNamed:@"RespectTestProject"];
+    XCBuildConfiguration *buildConfiguration = [nativeTarget configurationNamed:@"Debug"];
+    XCTAssertTrue([pbxProject prepareWithEnvironment:nil
+                                        nativeTarget:nativeTarget
+                                  buildConfiguration:buildConfiguration
+                                               error:&error], @"");
+
+    PBXGroup *group = nil;
+    PBXNode *node = nil;
+    for (PBXNode *child in pbxProject.mainGroup.children) {
+        if (![child isKindOfClass:[PBXGroup class]]) {
+            continue;
+        }
+
+        for (PBXNode *groupChild in ((PBXGroup *)child).children) {
+            if (groupChild.path != nil &&
+                [groupChild.sourceTree isEqualToString:@"<group>"]) {
+                group = (PBXGroup *)child;
+                node = groupChild;
+                break;
+            }
+        }
+
+        if (node != nil) {
+            break;
+        }
+    }
+    XCTAssertNotNil(node, @"");
+    XCTAssertEqualObjects([node buildPath],
+                          [[group buildPath] stringByAppendingPathComponent:node.path].stringByStandardizingPath,
+                          @"");
+    XCTAssertTrue([[node buildPath] hasPrefix:[pbxProject sourceRoot]], @"");
+
+    // prepare invalidates resolved paths
+    XCTAssertTrue([pbxProject prepareWithEnvironment:@{@"SOURCE_ROOT": @"/respect_test_root"}
+                                        nativeTarget:nativeTarget
+                                  buildConfiguration:buildConfiguration
+                                               error:&error], @"");
+    XCTAssertTrue([[node buildPath] hasPrefix:@"/respect_test_root/"], @"");
+}
+
 @end
@@ -0,0 +1,46 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ParameterTemplateTest.h"
+#import "ParameterTemplate.h"
+
+@implementation ParameterTemplateTest
+
+- (void)testParameterTemplate {
+    NSArray *parameters = @[@"en/a.png", @"a", @"png", @"dir", @"en"];
+
+    ParameterTemplate *pathTemplate = [ParameterTemplate templateWithString:@"$4.lproj/$3/$1.$2"];
+    XCTAssertTrue(pathTemplate.hasParameters, @"");
+    XCTAssertEqualObjects([pathTemplate stringByReplacingParameters:parameters],
+                          @"en.lproj/dir/a.png", @"");
+    XCTAssertEqualObjects([pathTemplate stringByReplacingParameters:@[@"x", @"y"]],
+                          @"$4.lproj/$3/y.$2", @"");
+
+    ParameterTemplate *literalTemplate = [ParameterTemplate templateWithString:@"a$.png$"];
+    XCTAssertFalse(literalTemplate.hasParameters, @"");
+    XCTAssertEqualObjects([literalTemplate stringByReplacingParameters:parameters],
+                          @"a$.png$", @"");
+
+    XCTAssertEqualObjects([[ParameterTemplate templateWithString:@"$$1$10"]
+                           stringByReplacingParameters:parameters],
+                          @"$a$10", @"");
+    XCTAssertEqualObjects([[ParameterTemplate templateWithString:@""]
+                           stringByReplacingParameters:parameters],
+                          @"", @"");
+}
+
+@end
@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "PathTableTest.h"
+#import "PathTable.h"
+
+@implementation PathTableTest
+
+- (void)testPathTable {
+    PathTable *pathTable = [[PathTable alloc] init];
+
+    NSUInteger aID = [pathTable pathIDForPath:@"dir/a.png"];
+    NSUInteger bID = [pathTable pathIDForPath:@"dir/b.png"];
+    XCTAssertTrue(aID != bID, @"");
+    XCTAssertEqual(pathTable.count, (NSUInteger)2, @"");
+
+    NSMutableString *a = [NSMutableString stringWithString:@"dir/"];
+    [a appendString:@"a.png"];
+    XCTAssertEqual([pathTable pathIDForPath:a], aID, @"");
+    XCTAssertEqual(pathTable.count, (NSUInteger)2, @"");
+    [a appendString:@"x"];
+    XCTAssertEqualObjects([pathTable pathForPathID:aID], @"dir/a.png", @"");
+
+    XCTAssertTrue([pathTable internedPath:[a substringToIndex:9]] ==
+                  [pathTable pathForPathID:aID], @"");
+
+    XCTAssertEqual([pathTable pathIDForPath:nil], (NSUInteger)NSNotFound, @"");
+    XCTAssertNil([pathTable pathForPathID:NSNotFound], @"");
+    XCTAssertNil([pathTable internedPath:nil], @"");
+}
+
+@end
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "ReferenceGraphTest.h"
+#import "ReferenceGraph.h"
+
+@implementation ReferenceGraphTest
+
+- (void)testReferenceGraph {
+    ReferenceGraph *graph = [[ReferenceGraph alloc] init];
+    __block NSUInteger hintCalls = 0;
+    NSString *(^hint)(void) = ^NSString *{
+        hintCalls++;
+        return @"hint";
+    };
+    BOOL isNew = NO;
+
+    ResourceReference *a = [graph addReferenceToResourcePath:@"a.png"
+                                               referencePath:@"a.m"
+                                           referenceLocation:MakeTextLocation(1, NSMakeRange(2, 3))
+                                               referenceHint:nil
+                                         missingResourceHint:hint
+                                                       isNew:&isNew];
+    XCTAssertTrue(isNew, @"");
+    XCTAssertEqualObjects(a.missingResourceHint, @"hint", @"");
+
+    ResourceReference *a2 = [graph addReferenceToResourcePath:@"a.png"
+                                                referencePath:@"a.m"
+                                            referenceLocation:MakeTextLocation(1, NSMakeRange(2, 3))
+                                                referenceHint:nil
+                                          missingResourceHint:hint
+                                                        isNew:&isNew];
+    XCTAssertFalse(isNew, @"");
+    XCTAssertTrue(a == a2, @"");
+    XCTAssertEqual(hintCalls, (NSUInteger)1, @"");
+
+    [graph addReferenceToResourcePath:@"a.png"
+                        referencePath:@"a.m"
+                    referenceLocation:MakeTextLocation(1, NSMakeRange(2, 3))
+                        referenceHint:@"key"
+                  missingResourceHint:nil
+                                isNew:&isNew];
+    XCTAssertTrue(isNew, @"");
+
+    // enough to grow edges and buckets
+    for (NSUInteger i = 0; i < 1000; i++) {
+        [graph addReferenceToResourcePath:@"b.png"
+                            referencePath:@"b.m"
+                        referenceLocation:MakeTextLineLocation(i)
+                            referenceHint:nil
+                      missingResourceHint:nil
+                                    isNew:NULL];
+        [graph addReferenceToResourcePath:@"b.png"
+                            referencePath:@"b.m"
+                        referenceLocation:MakeTextLineLocation(i)
+                            referenceHint:nil
+                      missingResourceHint:nil
+                                    isNew:NULL];
+    }
+
+    XCTAssertEqual(graph.count, (NSUInteger)1002, @"");
+    XCTAssertEqual(graph.references.count, (NSUInteger)1002, @"");
+    XCTAssertEqual(graph.edges[1001].lineNumber, (NSUInteger)999, @"");
+    XCTAssertEqualObjects([graph.references[1001] resourcePath], @"b.png", @"");
+
+    // paths are interned per graph and not shared with other graphs
+    XCTAssertEqualObjects([graph.pathTable pathForPathID:
+                           [graph.references[1001] resourcePathID]], @"b.png", @"");
+    XCTAssertEqual([[ReferenceGraph alloc] init].pathTable.count, (NSUInteger)0, @"");
+    // hints are not paths and are kept out of the path table
+    XCTAssertEqual(graph.pathTable.count, (NSUInteger)4, @"");
+}
+
+@end
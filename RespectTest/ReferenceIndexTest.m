@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ReferenceIndexTest.h"
+#import "ReferenceIndex.h"
+#import "TestTemporaryDirectory.h"
+
+@implementation ReferenceIndexTest
+
+- (void)addEntryToWriter:(ReferenceIndexWriter *)writer
+            resourcePath:(NSString *)resourcePath
+           referencePath:(NSString *)referencePath
+              lineNumber:(NSUInteger)lineNumber
+                 runName:(NSString *)runName {
+    [writer addEntry:[[ReferenceIndexEntry alloc] initWithResourcePath:resourcePath
+                                                          referencePath:referencePath
+                                                             lineNumber:lineNumber
+                                                                runName:runName
+                                                              isMissing:NO]];
+}
+
+- (void)testQueries {
+    ReferenceIndexWriter *writer = [[ReferenceIndexWriter alloc] init];
+    [self addEntryToWriter:writer resourcePath:@"images/a.png" referencePath:@"View.m"
+                lineNumber:12 runName:@"App App Release"];
+    [self addEntryToWriter:writer resourcePath:@"a.png" referencePath:@"Sub/Other.m"
+                lineNumber:3 runName:@"App App Release"];
+    // same edge twice is stored once
+    [self addEntryToWriter:writer resourcePath:@"a.png" referencePath:@"Sub/Other.m"
+                lineNumber:3 runName:@"App App Release"];
+    [self addEntryToWriter:writer resourcePath:@"ba.png" referencePath:@"View.m"
+                lineNumber:2 runName:@"App App Release"];
+    [writer addEntry:[[ReferenceIndexEntry alloc] initWithResourcePath:@"missing.png"
+                                                         referencePath:@"View.m"
+                                                            lineNumber:20
+                                                               runName:@"App App Release"
+                                                             isMissing:YES]];
+    [writer addBundleResourcePath:@"images/a.png" runName:@"App App Release"];
+    [writer addBundleResourcePath:@"a.png" runName:@"App App Release"];
+    [writer addBundleResourcePath:@"unused/a.png" runName:@"App App Release"];
+
+    NSError *error = nil;
+    ReferenceIndex *index = [[ReferenceIndex alloc] initWithData:[writer indexData] error:&error];
+    XCTAssertNotNil(index, @"");
+    XCTAssertEqual(index.runCount, (NSUInteger)1, @"");
+
+    NSArray *entries = [index referencesToPath:@"a.png"];
+    XCTAssertEqualObjects([entries valueForKey:@"resourcePath"], (@[@"a.png", @"images/a.png"]), @"");
+    XCTAssertEqualObjects([entries valueForKey:@"referencePath"], (@[@"Sub/Other.m", @"View.m"]), @"");
+    XCTAssertEqual([entries[1] lineNumber], (NSUInteger)12, @"");
+    XCTAssertEqualObjects([entries[1] runName], @"App App Release", @"");
+    XCTAssertEqual([index referencesToPath:@"images/a.png"].count, (NSUInteger)1, @"");
+    XCTAssertEqual([index referencesToPath:@"png"].count, (NSUInteger)0, @"");
+
+    entries = [index referencesByPath:@"View.m"];
+    XCTAssertEqualObjects([entries valueForKey:@"resourcePath"],
+                          (@[@"ba.png", @"images/a.png", @"missing.png"]), @"");
+    XCTAssertTrue([entries[2] isMissing], @"");
+    XCTAssertFalse([entries[0] isMissing], @"");
+    XCTAssertEqual([index referencesByPath:@"Other.m"].count, (NSUInteger)1, @"");
+
+    XCTAssertEqualObjects([index bundleResourcesMatchingPath:@"a.png"],
+                          (@[@"a.png", @"images/a.png", @"unused/a.png"]), @"");
+}
+
+- (void)testInvalidData {
+    NSError *error = nil;
+    XCTAssertNil([[ReferenceIndex alloc] initWithData:[NSData data] error:&error], @"");
+    XCTAssertNotNil(error, @"");
+
+    ReferenceIndexWriter *writer = [[ReferenceIndexWriter alloc] init];
+    [self addEntryToWriter:writer resourcePath:@"a.png" referencePath:@"View.m"
+                lineNumber:1 runName:@"App App Release"];
+    NSData *data = [writer indexData];
+    error = nil;
+    XCTAssertNil([[ReferenceIndex alloc] initWithData:[data subdataWithRange:
+                                                       NSMakeRange(0, data.length - 1)]
+                                                error:&error], @"");
+    XCTAssertNotNil(error, @"");
+}
+
+- (void)testUpdateKeepsOtherRuns {
+    TestTemporaryDirectory *tmp = [TestTemporaryDirectory temporaryDirectory];
+    NSString *path = [tmp pathForName:@"respect.index"];
+
+    ReferenceIndexWriter *writer = [[ReferenceIndexWriter alloc] init];
+    [self addEntryToWriter:writer resourcePath:@"a.png" referencePath:@"View.m"
+                lineNumber:1 runName:@"App App Debug"];
+    [self addEntryToWriter:writer resourcePath:@"a.png" referencePath:@"View.m"
+                lineNumber:1 runName:@"App App Release"];
+    XCTAssertTrue([writer updateIndexAtPath:path error:NULL], @"");
+
+    // release is replaced, debug is kept
+    writer = [[ReferenceIndexWriter alloc] init];
+    [self addEntryToWriter:writer resourcePath:@"a.png" referencePath:@"View.m"
+                lineNumber:2 runName:@"App App Release"];
+    XCTAssertTrue([writer updateIndexAtPath:path error:NULL], @"");
+
+    ReferenceIndex *index = [ReferenceIndex indexWithContentsOfFile:path error:NULL];
+    XCTAssertEqual(index.runCount, (NSUInteger)2, @"");
+    NSArray *entries = [index referencesToPath:@"a.png"];
+    XCTAssertEqualObjects([entries valueForKey:@"runName"],
+                          (@[@"App App Debug", @"App App Release"]), @"");
+    XCTAssertEqualObjects([entries valueForKey:@"lineNumber"], (@[@1, @2]), @"");
+
+    [tmp remove];
+}
+
+@end
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ResourceContentPrefetcherTest.h"
+#import "ResourceContentPrefetcher.h"
+
+@implementation ResourceContentPrefetcherTest
+
+- (void)testContentOfPath {
+    ResourceContentPrefetcher *prefetcher = [[ResourceContentPrefetcher alloc] init];
+    NSObject *lock = [[NSObject alloc] init];
+    __block NSUInteger parseCount = 0;
+    ResourceContentParseBlock parseBlock = ^id(NSString *path, NSString **errorMessage) {
+        @synchronized(lock) {
+            parseCount++;
+        }
+        if ([path isEqualToString:@"bad"]) {
+            *errorMessage = @"Failed";
+            return nil;
+        }
+        return [path uppercaseString];
+    };
+
+    for (NSUInteger i = 0; i < 100; i++) {
+        [prefetcher prefetchContentOfPath:[NSString stringWithFormat:@"a%lu", i]
+                               parseBlock:parseBlock];
+    }
+    // already scheduled
+    [prefetcher prefetchContentOfPath:@"a0" parseBlock:parseBlock];
+    [prefetcher prefetchContentOfPath:@"bad" parseBlock:parseBlock];
+
+    for (NSUInteger i = 0; i < 100; i++) {
+        XCTAssertEqualObjects([prefetcher contentOfPath:[NSString stringWithFormat:@"a%lu", i]
+                                             parseBlock:parseBlock
+                                           errorMessage:NULL],
+                              ([NSString stringWithFormat:@"A%lu", i]), @"");
+    }
+
+    NSString *errorMessage = nil;
+    XCTAssertNil([prefetcher contentOfPath:@"bad" parseBlock:parseBlock errorMessage:&errorMessage], @"");
+    XCTAssertEqualObjects(errorMessage, @"Failed", @"");
+    XCTAssertEqual(parseCount, (NSUInteger)101, @"");
+
+    // not prefetched is parsed on request
+    XCTAssertEqualObjects([prefetcher contentOfPath:@"b" parseBlock:parseBlock errorMessage:NULL],
+                          @"B", @"");
+    XCTAssertEqual(parseCount, (NSUInteger)102, @"");
+
+    // returned content is not kept
+    XCTAssertEqualObjects([prefetcher contentOfPath:@"a0" parseBlock:parseBlock errorMessage:NULL],
+                          @"A0", @"");
+    XCTAssertEqual(parseCount, (NSUInteger)103, @"");
+}
+
+- (void)testContentOfPathDifferentParseBlocks {
+    ResourceContentPrefetcher *prefetcher = [[ResourceContentPrefetcher alloc] init];
+    ResourceContentParseBlock upperBlock = ^id(NSString *path, NSString **errorMessage) {
+        return [path uppercaseString];
+    };
+    ResourceContentParseBlock lengthBlock = ^id(NSString *path, NSString **errorMessage) {
+        return @(path.length);
+    };
+
+    [prefetcher prefetchContentOfPath:@"a" parseBlock:upperBlock];
+    [prefetcher prefetchContentOfPath:@"a" parseBlock:lengthBlock];
+
+    // each consumer gets content parsed by its own block
+    XCTAssertEqualObjects([prefetcher contentOfPath:@"a" parseBlock:lengthBlock errorMessage:NULL],
+                          @1, @"");
+    XCTAssertEqualObjects([prefetcher contentOfPath:@"a" parseBlock:upperBlock errorMessage:NULL],
+                          @"A", @"");
+}
+
+@end
@@ -262,7 +262,7 @@
                                     [ResourceLinterConfigReport class]]) {
             ResourceLinterAbstractReport *reporter = [[reportClass alloc]
                                                       initWithLinter:linter];
-            (void)reporter;
+            [reporter writeReport];
         }
         
         success &= ([expectedUnused isEqualToSet:actualUnused] &&
@@ -1,5 +1,9 @@
 // @LintWarning: test warning
 
+// same content, only warned about with --duplicates
+// @LintFile: duplicate_a.txt
+// @LintFile: duplicate_b.txt
+
 // TODO: strings?
 // TODO: nib
 // TODO: more functions
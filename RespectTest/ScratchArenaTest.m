@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ScratchArenaTest.h"
+#import "ScratchArena.h"
+
+@implementation ScratchArenaTest
+
+- (void)testAlloc {
+    ScratchArena *arena = ScratchArenaCreate(64);
+
+    char *a = ScratchArenaAlloc(arena, 3);
+    char *b = ScratchArenaAlloc(arena, 1000);
+    memcpy(a, "abc", 3);
+    memset(b, 'x', 1000);
+    XCTAssertEqual((uintptr_t)a % 16, (uintptr_t)0, @"");
+    XCTAssertEqual((uintptr_t)b % 16, (uintptr_t)0, @"");
+    XCTAssertTrue(memcmp(a, "abc", 3) == 0, @"");
+    XCTAssertEqual(ScratchArenaUsedBytes(arena), (size_t)(16 + 1008), @"");
+
+    ScratchArenaReset(arena);
+    XCTAssertEqual(ScratchArenaUsedBytes(arena), (size_t)0, @"");
+    // largest block is kept and reused
+    XCTAssertEqual((char *)ScratchArenaAlloc(arena, 1000), b, @"");
+
+    ScratchArenaDestroy(arena);
+}
+
+- (void)testRealloc {
+    ScratchArena *arena = ScratchArenaCreate(256);
+
+    char *a = ScratchArenaAlloc(arena, 16);
+    memcpy(a, "0123456789abcdef", 16);
+    // last allocation grows in place
+    XCTAssertEqual((char *)ScratchArenaRealloc(arena, a, 16, 64), a, @"");
+
+    ScratchArenaAlloc(arena, 16);
+    char *b = ScratchArenaRealloc(arena, a, 64, 128);
+    XCTAssertTrue(b != a, @"");
+    XCTAssertTrue(memcmp(b, "0123456789abcdef", 16) == 0, @"");
+
+    ScratchArenaDestroy(arena);
+}
+
+@end
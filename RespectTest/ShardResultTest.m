@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#import "ShardResultTest.h"
+#import "ShardResult.h"
+#import "TestTemporaryDirectory.h"
+
+@implementation ShardResultTest
+
+- (void)testParseShardString {
+    NSUInteger index = 0;
+    NSUInteger count = 0;
+
+    XCTAssertTrue([ShardResult parseShardString:@"2/3" shardIndex:&index shardCount:&count], @"");
+    XCTAssertEqual(index, (NSUInteger)2, @"");
+    XCTAssertEqual(count, (NSUInteger)3, @"");
+    XCTAssertTrue([ShardResult parseShardString:@"0/1" shardIndex:&index shardCount:&count], @"");
+    XCTAssertFalse([ShardResult parseShardString:@"3/3" shardIndex:&index shardCount:&count], @"");
+    XCTAssertFalse([ShardResult parseShardString:@"0/0" shardIndex:&index shardCount:&count], @"");
+    XCTAssertFalse([ShardResult parseShardString:@"-1/2" shardIndex:&index shardCount:&count], @"");
+    XCTAssertFalse([ShardResult parseShardString:@"1" shardIndex:&index shardCount:&count], @"");
+    XCTAssertFalse([ShardResult parseShardString:@"1/2x" shardIndex:&index shardCount:&count], @"");
+}
+
+- (void)testWriteAndMerge {
+    TestTemporaryDirectory *tmp = [TestTemporaryDirectory temporaryDirectory];
+    NSMutableArray *paths = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 2; i++) {
+        ShardResult *shardResult = [[ShardResult alloc] initWithShardIndex:i
+                                                                shardCount:2
+                                                               projectPath:@"App.xcodeproj"];
+        [shardResult addRun:@{@"project": @"App",
+                              @"target": @"App",
+                              @"configuration": @"Release",
+                              @"matchCounts": @[@(i)]}];
+        NSString *path = [tmp pathForName:[NSString stringWithFormat:@"%ld", i]];
+        XCTAssertTrue([shardResult writeToPath:path error:NULL], @"");
+        [paths addObject:path];
+    }
+
+    NSError *error = nil;
+    NSArray *shardResults = [ShardResult shardResultsWithContentsOfFiles:
+                             [[paths reverseObjectEnumerator] allObjects]
+                                                                   error:&error];
+    XCTAssertEqual(shardResults.count, (NSUInteger)2, @"");
+    XCTAssertEqual([shardResults[0] shardIndex], (NSUInteger)0, @"");
+    XCTAssertEqualObjects([shardResults[1] projectPath], @"App.xcodeproj", @"");
+    NSArray *runs = [ShardResult runsInShardResults:shardResults
+                                        projectName:@"App"
+                                         targetName:@"App"
+                                  configurationName:@"Release"];
+    XCTAssertEqualObjects([runs valueForKey:@"matchCounts"], (@[@[@0], @[@1]]), @"");
+    XCTAssertEqual([ShardResult runsInShardResults:shardResults
+                                       projectName:@"App"
+                                        targetName:@"App"
+                                 configurationName:@"Debug"].count, (NSUInteger)0, @"");
+
+    XCTAssertNil([ShardResult shardResultsWithContentsOfFiles:@[paths[0]] error:&error], @"");
+    XCTAssertEqualObjects(error.localizedDescription, @"Shard 1/2 is missing", @"");
+    XCTAssertNil([ShardResult shardResultsWithContentsOfFiles:@[paths[1], paths[1]] error:&error], @"");
+    XCTAssertEqualObjects(error.localizedDescription, @"Shard 0/2 is missing", @"");
+    XCTAssertNil([ShardResult shardResultsWithContentsOfFiles:@[paths[0], paths[0]] error:&error], @"");
+    XCTAssertEqualObjects(error.localizedDescription, @"Shard 0/2 is included more than once", @"");
+
+    [tmp remove];
+}
+
+@end
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#import "TestTemporaryDirectory.h"
+
+@interface TestTemporaryDirectory ()
+@property(nonatomic, copy, readwrite) NSString *path;
+@end
+
+@implementation TestTemporaryDirectory
+
++ (instancetype)temporaryDirectory {
+    return [[self alloc] init];
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self == nil) {
+        return nil;
+    }
+
+    self.path = [NSTemporaryDirectory() stringByAppendingPathComponent:
+                 [NSProcessInfo processInfo].globallyUniqueString];
+    [[NSFileManager defaultManager] createDirectoryAtPath:self.path
+                              withIntermediateDirectories:YES
+                                               attributes:nil
+                                                    error:NULL];
+
+    return self;
+}
+
+- (NSString *)pathForName:(NSString *)name {
+    return [self.path stringByAppendingPathComponent:name];
+}
+
+- (NSString *)writeData:(NSData *)data toName:(NSString *)name {
+    NSString *path = [self pathForName:name];
+    [[NSFileManager defaultManager] createDirectoryAtPath:path.stringByDeletingLastPathComponent
+                              withIntermediateDirectories:YES
+                                               attributes:nil
+                                                    error:NULL];
+    [data writeToFile:path atomically:NO];
+
+    return path;
+}
+
+- (NSString *)writeString:(NSString *)string toName:(NSString *)name {
+    return [self writeData:[string dataUsingEncoding:NSUTF8StringEncoding] toName:name];
+}
+
+- (void)remove {
+    [[NSFileManager defaultManager] removeItemAtPath:self.path error:NULL];
+}
+
+@end
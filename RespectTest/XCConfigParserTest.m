@@ -21,6 +21,7 @@
 
 #import "XCConfigParserTest.h"
 #import "XCConfigParser.h"
+#import "TestTemporaryDirectory.h"
 
 
 static BOOL XCConfigParserTestCase(NSString *testName) {
@@ -85,6 +86,62 @@ static BOOL XCConfigParserTestCase(NSString *testName) {
     XCTAssertTrue(XCConfigParserTestCase(@"xcconfig_test8.xcconfig"), @"");
     XCTAssertTrue(XCConfigParserTestCase(@"xcconfig_test9.xcconfig"), @"");
     XCTAssertTrue(XCConfigParserTestCase(@"xcconfig_test10.xcconfig"), @"");
+    XCTAssertTrue(XCConfigParserTestCase(@"xcconfig_test11.xcconfig"), @"");
+    XCTAssertTrue(XCConfigParserTestCase(@"xcconfig_test12.xcconfig"), @"");
+}
+
+- (void)testErrorLineNumber {
+    // CR, CRLF and line separator end lines like LF
+    for (NSString *string in @[@"\n \n\u00a7",
+                               @"\r \r\u00a7",
+                               @"\r\n \r\n\u00a7",
+                               @"\u2028 \u2028\u00a7"]) {
+        NSError *error = nil;
+        XCTAssertNil([XCConfigParser dictionaryFromString:string
+                                          includeBasePath:@"/"
+                                                    error:&error], @"");
+        XCTAssertEqualObjects(error.userInfo[XCConfigParserLineNumberKey], @3, @"");
+        XCTAssertEqualObjects(error.userInfo[XCConfigParserCharacterLocationKey],
+                              @(string.length - 1), @"");
+    }
+}
+
+- (void)testIncludeChanged {
+    TestTemporaryDirectory *tmp = [TestTemporaryDirectory temporaryDirectory];
+    NSString *basePath = [tmp writeString:@"#include \"include.xcconfig\"\n"
+                                   toName:@"base.xcconfig"];
+    NSString *includePath = [tmp pathForName:@"include.xcconfig"];
+
+    // whole seconds so that setting it again gives the same stat mtime
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1000000000];
+    void (^writeInclude)(NSString *, NSDate *) = ^(NSString *content, NSDate *modificationDate) {
+        [content writeToFile:includePath
+                  atomically:NO
+                    encoding:NSUTF8StringEncoding
+                       error:NULL];
+        [[NSFileManager defaultManager] setAttributes:@{NSFileModificationDate: modificationDate}
+                                         ofItemAtPath:includePath
+                                                error:NULL];
+    };
+
+    writeInclude(@"key = aaa\n", date);
+    XCTAssertEqualObjects([XCConfigParser dictionaryFromFile:basePath error:NULL],
+                          @{@"key": @"aaa"}, @"");
+
+    // same size and modification time, parsed table is reused
+    writeInclude(@"key = bbb\n", date);
+    XCTAssertEqualObjects([XCConfigParser dictionaryFromFile:basePath error:NULL],
+                          @{@"key": @"aaa"}, @"");
+
+    writeInclude(@"key = bbb\n", [date dateByAddingTimeInterval:10]);
+    XCTAssertEqualObjects([XCConfigParser dictionaryFromFile:basePath error:NULL],
+                          @{@"key": @"bbb"}, @"");
+
+    writeInclude(@"key = cccc\n", [date dateByAddingTimeInterval:10]);
+    XCTAssertEqualObjects([XCConfigParser dictionaryFromFile:basePath error:NULL],
+                          @{@"key": @"cccc"}, @"");
+
+    [tmp remove];
 }
 
 @end
@@ -0,0 +1,9 @@
+PROJECT=RespectTest/RespectTestProject/RespectTestProject.xcodeproj
+
+respect --duplicates $PROJECT | \
+  grep -q "RespectTestProject/duplicate_b.txt: Bundle path \"duplicate_b.txt\" has same content as \"duplicate_a.txt\""
+
+# only checked with --duplicates
+if respect $PROJECT | grep -q "has same content as" ; then
+  exit 1
+fi
@@ -0,0 +1,16 @@
+PROJECT=RespectTest/RespectTestProject/RespectTestProject.xcodeproj
+INDEX="$(mktemp -t respect_index)"
+rm -f "$INDEX"
+
+respect --index "$INDEX" --target TestImage $PROJECT > /dev/null
+respect query --index "$INDEX" --references-to c.png | grep -q "TestImage/test.m:[0-9]*: c.png$"
+respect query --index "$INDEX" --referenced-by test.m | grep -q ": a.png (missing)$"
+respect query --index "$INDEX" --references-to nonexisting.png 2>&1 | grep -q "No resource or reference matching"
+
+# other runs are kept when updating the index
+respect --index "$INDEX" --target RespectTestProject $PROJECT > /dev/null
+respect query --index "$INDEX" --references-to c.png | grep -q "test.m:[0-9]*: c.png \[RespectTestProject TestImage Release\]$"
+
+respect query --references-to c.png 2>&1 | grep -q "Usage:"
+
+rm -f "$INDEX"
@@ -16,4 +16,10 @@ t xcode.sh
 t config.sh
 t nodefault.sh
 t dump.sh
+t targets.sh
+t workspace.sh
+t duplicates.sh
+t sizes.sh
+t shard.sh
+t query.sh
 
@@ -0,0 +1,27 @@
+PROJECT=RespectTest/RespectTestProject/RespectTestProject.xcodeproj
+SHARD_DIR="$(mktemp -d -t respect_shard)"
+
+respect $PROJECT > "$SHARD_DIR/lint.txt"
+respect --shard 0/3 --shard-output "$SHARD_DIR/0" $PROJECT
+respect --shard 1/3 --shard-output "$SHARD_DIR/1" $PROJECT
+respect --shard 2/3 --shard-output "$SHARD_DIR/2" $PROJECT
+respect merge "$SHARD_DIR/2" "$SHARD_DIR/0" "$SHARD_DIR/1" > "$SHARD_DIR/merge.txt"
+diff "$SHARD_DIR/lint.txt" "$SHARD_DIR/merge.txt" > /dev/null
+
+# project path is stored absolute so merge works from another directory
+(cd "$SHARD_DIR" && respect merge 2 0 1) > "$SHARD_DIR/merge_cwd.txt"
+diff "$SHARD_DIR/lint.txt" "$SHARD_DIR/merge_cwd.txt" > /dev/null
+
+# same number of matchers but different config can't be merged
+mkdir "$SHARD_DIR/a" "$SHARD_DIR/b"
+printf '@LintSourceMatch: [Foo a:@]\n@LintFile: $1\n' > "$SHARD_DIR/a/respect.config"
+printf '@LintSourceMatch: [Foo b:@]\n@LintFile: $1\n' > "$SHARD_DIR/b/respect.config"
+respect -c "$SHARD_DIR/a/respect.config" --shard 0/2 --shard-output "$SHARD_DIR/a0" $PROJECT
+respect -c "$SHARD_DIR/b/respect.config" --shard 1/2 --shard-output "$SHARD_DIR/b1" $PROJECT
+respect merge -c "$SHARD_DIR/a/respect.config" "$SHARD_DIR/a0" "$SHARD_DIR/b1" 2>&1 | \
+    grep -q "Shard result was linted using a different configuration"
+
+respect merge "$SHARD_DIR/0" "$SHARD_DIR/1" 2>&1 | grep -q "Shard 2/3 is missing"
+respect --shard 3/3 --shard-output "$SHARD_DIR/3" $PROJECT 2>&1 | grep -q "Invalid shard"
+
+rm -rf "$SHARD_DIR"
@@ -0,0 +1,9 @@
+respect --sizes RespectTest/RespectTestProject/RespectTestProject.xcodeproj | \
+  grep -q "bytes referenced, .* unused (.* ignored)"
+
+SIZES_DIR="$(mktemp -d -t respect_sizes)"
+SIZES_CSV="$SIZES_DIR/sizes.csv"
+respect --sizes-output "$SIZES_CSV" RespectTest/RespectTestProject/RespectTestProject.xcodeproj > /dev/null
+head -n 1 "$SIZES_CSV" | grep -q "^project,target,configuration,kind,name,"
+grep -q ",RespectTestProject,Release,total," "$SIZES_CSV"
+rm -rf "$SIZES_DIR"
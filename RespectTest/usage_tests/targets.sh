@@ -0,0 +1,22 @@
+respect \
+  --target RespectTestProject \
+  --configuration Debug \
+  --configuration Release \
+  RespectTest/RespectTestProject/RespectTestProject.xcodeproj | \
+  grep -c "RespectTestProject/main.m:1: test warning" | \
+  grep -q "^2$"
+
+respect \
+  --target TestIOSDefault \
+  --target RespectTestProject \
+  RespectTest/RespectTestProject/RespectTestProject.xcodeproj | \
+  grep -q "Target \"RespectTestProject\" configuration \"Release\":"
+
+respect --target non_existing RespectTest/RespectTestProject/RespectTestProject.xcodeproj 2>&1 | grep -q "No native target named"
+
+respect --target TestIOSDefault \
+  RespectTest/RespectTestProject/RespectTestProject.xcodeproj RespectTestProject 2>&1 | \
+  grep -q "given both as argument and with --target"
+respect --configuration Debug \
+  RespectTest/RespectTestProject/RespectTestProject.xcodeproj RespectTestProject Release 2>&1 | \
+  grep -q "given both as argument and with --configuration"
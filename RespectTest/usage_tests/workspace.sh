@@ -0,0 +1,14 @@
+respect \
+  --scheme RespectTestProject \
+  RespectTest/RespectTestWorkspace.xcworkspace | \
+  grep -q "RespectTestProject/main.m:1: test warning"
+
+respect \
+  --target RespectTestProject \
+  --configuration Debug \
+  --configuration Release \
+  RespectTest/RespectTestWorkspace.xcworkspace | \
+  grep -q "Project \"RespectTestProject\" target \"RespectTestProject\" configuration \"Debug\":"
+
+respect RespectTest/RespectTestWorkspace.xcworkspace 2>&1 | grep -q "Suggested schemes: RespectTestProject"
+respect --scheme non_existing RespectTest/RespectTestWorkspace.xcworkspace 2>&1 | grep -q "No shared scheme named"
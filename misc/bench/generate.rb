@@ -0,0 +1,334 @@
+#!/usr/bin/env ruby
+#
+# Generate a synthetic Xcode project for benchmarking respect.
+#
+# Usage: generate.rb [options] OutputDir
+#
+# Creates OutputDir/Bench.xcodeproj with one native iOS target "Bench" and
+# OutputDir/Features/*Feature.xcodeproj usable with --spfeatures. Output is
+# deterministic for the same options and seed.
+#
+# Requires ruby 1.9 and has no dependencies on gems.
+#
+# Copyright (c) 2013 <mattias.wadman@gmail.com>
+#
+# MIT License:
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+require "fileutils"
+require "optparse"
+
+DEFAULT_BENCH_OPTIONS = {
+  :sources => 200,
+  :includes => 3,
+  :images_per_source => 5,
+  :resources => 1000,
+  :folders => 5,
+  :folder_files => 20,
+  :xibs => 20,
+  :xcconfig_depth => 3,
+  :features => 0,
+  :seed => 1
+}
+
+# 1x1 transparent PNG
+BENCH_PNG = [
+  "89504e470d0a1a0a0000000d4948445200000001000000010806000000" \
+  "1f15c4890000000d4944415478da63f8ffff3f0005fe02fea7d6a4f500" \
+  "00000049454e44ae426082"
+].pack("H*")
+
+class PBXWriter
+  def initialize
+    @next_id = 0
+    @objects = []
+  end
+
+  def id
+    @next_id += 1
+    "BE0C%020X" % @next_id
+  end
+
+  def add(isa, fields)
+    object_id = id
+    @objects << [object_id, isa, fields]
+    object_id
+  end
+
+  def quote(value)
+    case value
+    when Array
+      "(" + value.map { |v| quote(v) + "," }.join(" ") + ")"
+    when Hash
+      "{" + value.map { |k, v| "#{quote(k.to_s)} = #{quote(v)};" }.join(" ") + "}"
+    else
+      s = value.to_s
+      if s =~ /\A[A-Za-z0-9_.\/]+\z/
+        s
+      else
+        "\"" + s.gsub("\\", "\\\\\\\\").gsub("\"", "\\\"") + "\""
+      end
+    end
+  end
+
+  def to_s(root_id)
+    lines = ["// !$*UTF8*$!", "{",
+             "\tarchiveVersion = 1;",
+             "\tclasses = {", "\t};",
+             "\tobjectVersion = 46;",
+             "\tobjects = {"]
+    @objects.each do |object_id, isa, fields|
+      body = fields.map { |k, v| "#{k} = #{quote(v)};" }.join(" ")
+      lines << "\t\t#{object_id} = {isa = #{isa}; #{body} };"
+    end
+    lines += ["\t};", "\trootObject = #{root_id};", "}", ""]
+    lines.join("\n")
+  end
+end
+
+def write_file(path, content)
+  FileUtils.mkdir_p(File.dirname(path))
+  File.open(path, "wb") { |f| f.write(content) }
+end
+
+def image_name(i)
+  "bench_image_#{i}"
+end
+
+# reference a bit more images than exists to also get missing references
+def random_image_name(rnd, opts)
+  image_name(rnd.rand([opts[:resources] + opts[:resources] / 10, 1].max))
+end
+
+def generate_source(rnd, opts, i, header_count)
+  lines = []
+  opts[:includes].times do |n|
+    lines << "#import \"BenchHeader#{(i + n) % header_count}.h\""
+  end
+  lines << ""
+  lines << "@implementation BenchClass#{i}"
+  lines << ""
+  lines << "- (void)load {"
+  opts[:images_per_source].times do
+    lines << "    [UIImage imageNamed:@\"#{random_image_name(rnd, opts)}\"];"
+    lines << "    // some padding so the source is not only references"
+    lines << "    NSLog(@\"%@\", [NSString stringWithFormat:@\"%d\", #{rnd.rand(1000)}]);"
+  end
+  if opts[:xibs] > 0 && i % 4 == 0
+    lines << "    [[UINib nibWithNibName:@\"BenchView#{i % opts[:xibs]}\" bundle:nil] " \
+             "instantiateWithOwner:self options:nil];"
+  end
+  if opts[:folders] > 0 && opts[:folder_files] > 0
+    lines << "    [[NSBundle mainBundle] pathForResource:@\"BenchFolder#{i % opts[:folders]}/" \
+             "file_#{rnd.rand(opts[:folder_files])}\" ofType:@\"txt\"];"
+  end
+  lines << "}"
+  lines << ""
+  lines << "@end"
+  lines << ""
+  lines.join("\n")
+end
+
+def generate_xib(rnd, opts, i)
+  strings = (0...3).map do |n|
+    "\t\t<object class=\"NSCustomResource\" key=\"NSImage#{n}\">\n" \
+    "\t\t\t<string key=\"NSClassName\">NSImage</string>\n" \
+    "\t\t\t<string key=\"NSResourceName\">#{random_image_name(rnd, opts)}.png</string>\n" \
+    "\t\t</object>\n"
+  end
+  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" \
+  "<archive type=\"com.apple.InterfaceBuilder3.CocoaTouch.XIB\" version=\"8.00\">\n" \
+  "\t<data>\n" + strings.join + "\t</data>\n</archive>\n"
+end
+
+# project with one native target, returns nothing
+def generate_project(dir, name, opts, rnd)
+  src_dir = File.join(dir, name)
+  pbx = PBXWriter.new
+  children = []
+  source_build_files = []
+  resource_build_files = []
+
+  add_file = lambda do |path, type, build_files|
+    file_ref = pbx.add("PBXFileReference",
+                       "lastKnownFileType" => type,
+                       "path" => path,
+                       "sourceTree" => "<group>")
+    children << file_ref
+    build_files << pbx.add("PBXBuildFile", "fileRef" => file_ref) if build_files
+    file_ref
+  end
+
+  header_count = [opts[:sources], 1].max
+  header_count.times do |i|
+    # headers include each other in a chain to exercise include depth
+    next_header = i + 1 < header_count ? "#import \"BenchHeader#{i + 1}.h\"\n" : ""
+    write_file(File.join(src_dir, "BenchHeader#{i}.h"),
+               "#{next_header}@interface BenchClass#{i} : NSObject\n@end\n")
+    add_file.call("BenchHeader#{i}.h", "sourcecode.c.h", nil)
+  end
+
+  opts[:sources].times do |i|
+    write_file(File.join(src_dir, "BenchSource#{i}.m"),
+               generate_source(rnd, opts, i, header_count))
+    add_file.call("BenchSource#{i}.m", "sourcecode.c.objc", source_build_files)
+  end
+
+  opts[:resources].times do |i|
+    path = "Images/#{image_name(i)}#{i % 3 == 0 ? "@2x" : ""}.png"
+    write_file(File.join(src_dir, path), BENCH_PNG)
+    add_file.call(path, "image.png", resource_build_files)
+  end
+
+  opts[:folders].times do |i|
+    opts[:folder_files].times do |n|
+      write_file(File.join(src_dir, "BenchFolder#{i}", "file_#{n}.txt"), "#{i} #{n}\n")
+    end
+    add_file.call("BenchFolder#{i}", "folder", resource_build_files)
+  end
+
+  opts[:xibs].times do |i|
+    write_file(File.join(src_dir, "BenchView#{i}.xib"), generate_xib(rnd, opts, i))
+    add_file.call("BenchView#{i}.xib", "file.xib", resource_build_files)
+  end
+
+  base_config_ref = nil
+  if opts[:xcconfig_depth] > 0
+    opts[:xcconfig_depth].times do |i|
+      include_line = (i + 1 < opts[:xcconfig_depth] ?
+                      "#include \"BenchConfig#{i + 1}.xcconfig\"\n" : "")
+      write_file(File.join(src_dir, "BenchConfig#{i}.xcconfig"),
+                 "#{include_line}BENCH_LEVEL_#{i} = #{i}\n" \
+                 "BENCH_LEVELS = $(inherited) $(BENCH_LEVEL_#{i})\n")
+    end
+    base_config_ref = add_file.call("BenchConfig0.xcconfig", "text.xcconfig", nil)
+  end
+
+  write_file(File.join(src_dir, "Info.plist"),
+             "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" \
+             "<plist version=\"1.0\">\n<dict>\n" \
+             "\t<key>CFBundleIdentifier</key>\n\t<string>bench.#{name}</string>\n" \
+             "</dict>\n</plist>\n")
+  add_file.call("Info.plist", "text.plist.xml", nil)
+
+  group = pbx.add("PBXGroup",
+                  "children" => children,
+                  "path" => name,
+                  "sourceTree" => "<group>")
+  main_group = pbx.add("PBXGroup",
+                       "children" => [group],
+                       "sourceTree" => "<group>")
+
+  build_settings = {
+    "SDKROOT" => "iphoneos",
+    "IPHONEOS_DEPLOYMENT_TARGET" => "6.0",
+    "INFOPLIST_FILE" => "#{name}/Info.plist",
+    "PRODUCT_NAME" => "$(TARGET_NAME)"
+  }
+  target_configs = ["Debug", "Release"].map do |config_name|
+    fields = {"buildSettings" => build_settings, "name" => config_name}
+    fields["baseConfigurationReference"] = base_config_ref if base_config_ref
+    pbx.add("XCBuildConfiguration", fields)
+  end
+  target_config_list = pbx.add("XCConfigurationList",
+                               "buildConfigurations" => target_configs,
+                               "defaultConfigurationName" => "Release")
+  project_configs = ["Debug", "Release"].map do |config_name|
+    pbx.add("XCBuildConfiguration", "buildSettings" => {}, "name" => config_name)
+  end
+  project_config_list = pbx.add("XCConfigurationList",
+                                "buildConfigurations" => project_configs,
+                                "defaultConfigurationName" => "Release")
+
+  sources_phase = pbx.add("PBXSourcesBuildPhase", "files" => source_build_files)
+  resources_phase = pbx.add("PBXResourcesBuildPhase", "files" => resource_build_files)
+  target = pbx.add("PBXNativeTarget",
+                   "buildConfigurationList" => target_config_list,
+                   "buildPhases" => [sources_phase, resources_phase],
+                   "name" => name,
+                   "productName" => name,
+                   "productType" => "com.apple.product-type.application")
+  project = pbx.add("PBXProject",
+                    "buildConfigurationList" => project_config_list,
+                    "knownRegions" => ["en"],
+                    "mainGroup" => main_group,
+                    "projectDirPath" => "",
+                    "projectRoot" => "",
+                    "targets" => [target])
+
+  write_file(File.join(dir, "#{name}.xcodeproj", "project.pbxproj"), pbx.to_s(project))
+end
+
+def generate_bench(output_dir, opts)
+  opts = DEFAULT_BENCH_OPTIONS.merge(opts)
+  rnd = Random.new(opts[:seed])
+
+  FileUtils.rm_rf(output_dir)
+  generate_project(output_dir, "Bench", opts, rnd)
+
+  # feature projects are a tenth of the main project
+  feature_opts = opts.merge(:sources => [opts[:sources] / 10, 1].max,
+                            :resources => 0,
+                            :folders => 0,
+                            :xibs => 0)
+  opts[:features].times do |i|
+    name = "Bench#{i}Feature"
+    feature_dir = File.join(output_dir, "Features", name)
+    generate_project(feature_dir, name, feature_opts, rnd)
+    [opts[:resources] / 10, 1].max.times do |n|
+      write_file(File.join(feature_dir, "Resources", "#{image_name(n)}_#{i}.png"), BENCH_PNG)
+    end
+  end
+
+  opts
+end
+
+def bench_option_parser(opts)
+  OptionParser.new do |o|
+    o.banner = "Usage: #{File.basename($0)} [options] OutputDir"
+    {
+      :sources => "Number of source files",
+      :includes => "Includes per source file",
+      :images_per_source => "imageNamed: calls per source file",
+      :resources => "Number of image resources",
+      :folders => "Number of folder references",
+      :folder_files => "Files per folder reference",
+      :xibs => "Number of xib files",
+      :xcconfig_depth => "Depth of xcconfig include chain",
+      :features => "Number of Spotify feature projects",
+      :seed => "Random seed"
+    }.each do |key, desc|
+      flag = "--" + key.to_s.gsub("_", "-")
+      o.on("#{flag} N", Integer, "#{desc} (#{DEFAULT_BENCH_OPTIONS[key]})") do |v|
+        opts[key] = v
+      end
+    end
+  end
+end
+
+if __FILE__ == $0
+  opts = {}
+  parser = bench_option_parser(opts)
+  parser.parse!(ARGV)
+  if ARGV.length != 1
+    puts parser.help
+    exit 1
+  end
+  generate_bench(ARGV[0], opts)
+end
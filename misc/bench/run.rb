@@ -0,0 +1,119 @@
+#!/usr/bin/env ruby
+#
+# Run respect against generated benchmark projects and append stage timings
+# and peak RSS as one JSON object per line to an output file.
+#
+# Usage: run.rb [-r respect] [-o bench_output.txt] [-n runs] [Preset...]
+#
+# Presets are small, medium, large, features and hits (all if none given).
+# Compare lines between revisions to catch throughput or memory regressions.
+#
+# Requires ruby 1.9 and has no dependencies on gems.
+#
+# Copyright (c) 2013 <mattias.wadman@gmail.com>
+#
+# MIT License:
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+require "json"
+require "open3"
+require "optparse"
+require "tmpdir"
+require "time"
+require File.expand_path("../generate", __FILE__)
+
+BENCH_PRESETS = {
+  "small" => {:sources => 50, :resources => 200, :xibs => 5},
+  "medium" => {:sources => 500, :resources => 3000, :xibs => 50, :folders => 10},
+  "large" => {:sources => 3000, :resources => 20000, :xibs => 200,
+              :folders => 40, :folder_files => 50, :xcconfig_depth => 8},
+  "features" => {:sources => 500, :resources => 3000, :features => 20},
+  # many references per file, compare peak RSS for memory changes
+  "hits" => {:sources => 500, :images_per_source => 200, :resources => 3000}
+}
+
+def git_revision
+  rev = `git rev-parse --short HEAD 2>/dev/null`.strip
+  rev.empty? ? nil : rev
+end
+
+def run_preset(respect, name, preset, runs, work_dir)
+  project_dir = File.join(work_dir, name)
+  opts = generate_bench(project_dir, preset)
+
+  args = [respect, File.join(project_dir, "Bench.xcodeproj"), "Bench", "Release"]
+  if opts[:features] > 0
+    args[1, 0] = ["--spfeatures", File.join(project_dir, "Features")]
+  end
+
+  (1..runs).map do |run|
+    timings_path = File.join(work_dir, "#{name}_#{run}_timings.json")
+    _, err, status = Open3.capture3(*(args[0, 1] + ["--timings", timings_path] + args[1..-1]))
+    if !status.success?
+      $stderr.puts "#{name}: respect failed: #{err}"
+      exit 1
+    end
+
+    {
+      "preset" => name,
+      "run" => run,
+      "revision" => git_revision,
+      "date" => Time.now.utc.iso8601,
+      "options" => opts,
+      "timings" => JSON.parse(File.read(timings_path))
+    }
+  end
+end
+
+respect = "respect"
+output_path = "bench_output.txt"
+runs = 3
+
+parser = OptionParser.new do |o|
+  o.banner = "Usage: #{File.basename($0)} [options] [Preset...]"
+  o.on("-r", "--respect Path", "respect binary (#{respect})") { |v| respect = v }
+  o.on("-o", "--output Path", "Append results to file (#{output_path})") { |v| output_path = v }
+  o.on("-n", "--runs N", Integer, "Runs per preset (#{runs})") { |v| runs = v }
+end
+parser.parse!(ARGV)
+
+presets = ARGV.empty? ? BENCH_PRESETS.keys : ARGV
+presets.each do |name|
+  if !BENCH_PRESETS[name]
+    $stderr.puts "Unknown preset #{name}, available: #{BENCH_PRESETS.keys.join(", ")}"
+    exit 1
+  end
+end
+
+Dir.mktmpdir("respect_bench") do |work_dir|
+  File.open(output_path, "a") do |output|
+    presets.each do |name|
+      run_preset(respect, name, BENCH_PRESETS[name], runs, work_dir).each do |result|
+        output.puts(JSON.generate(result))
+        stages = result["timings"]["stages"].map do |stage|
+          "%s %.3fs" % [stage["name"], stage["seconds"]]
+        end
+        puts "%s #%d: %s total %.3fs peak %.1fMB" % [
+          name, result["run"], stages.join(" "),
+          result["timings"]["totalSeconds"],
+          result["timings"]["peakResidentBytes"] / 1048576.0]
+      end
+    end
+  end
+end
@@ -0,0 +1,105 @@
+#!/usr/bin/env ruby
+#
+# Turn a respect config file into a C table of ConfigLineEntry structs.
+#
+# Usage: config_table.rb File.config > File.config.table.generated.c
+#
+# Used by a run script to embed the default configuration into the binary so
+# that it does not have to be parsed at runtime. Unknown config names and
+# missing colons are reported as build errors.
+#
+# Requires ruby 1.9 and has no dependencies on gems.
+#
+# Copyright (c) 2013 <mattias.wadman@gmail.com>
+#
+# MIT License:
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+# keep in sync with ConfigLine.m and ResourceLinter.m
+CONFIG_RE = /@Lint([A-Za-z]+?)(Default)?(:| )(.*)/
+CONFIG_NAMES = %w[
+  SourceMatch ResourceMatch File Image Nib InfoPlist Warning
+  IgnoreMissing IgnoreUnused IgnoreWarning IgnoreError
+]
+
+def c_string(s)
+  out = "\""
+  s.each_byte do |b|
+    c = b.chr
+    if c == "\\" or c == "\"" or c == "?"
+      out << "\\" << c
+    elsif b < 0x20 or b > 0x7e
+      out << format("\\%03o", b)
+    else
+      out << c
+    end
+  end
+  out << "\""
+end
+
+def config_table(path)
+  name = File.basename(path).gsub(/[^A-Za-z0-9]/, "_")
+  entries = []
+  errors = []
+
+  File.open(path, "r:UTF-8") do |f|
+    f.each_line.with_index(1) do |line, line_number|
+      m = CONFIG_RE.match(line.chomp)
+      next if not m
+
+      location = "#{path}:#{line_number}"
+      if not CONFIG_NAMES.include?(m[1])
+        errors << "#{location}: error: Unknown config @Lint#{m[1]}"
+      elsif m[3] != ":"
+        errors << "#{location}: error: Missing colon after @Lint#{m[1]}#{m[2]}"
+      end
+
+      entries << [
+        line_number,
+        m.begin(0) + 1,
+        m[0].length,
+        c_string(m[1]),
+        m[2] ? "YES" : "NO",
+        c_string(m[4].strip)
+      ]
+    end
+  end
+
+  if not errors.empty?
+    $stderr.puts errors
+    exit 1
+  end
+
+  out = []
+  out << "// generated from #{File.basename(path)} by config_table.rb, do not edit"
+  out << "static const ConfigLineEntry #{name}_table[] = {"
+  entries.each do |e|
+    out << "    {#{e.join(", ")}},"
+  end
+  out << "};"
+  out << "static const NSUInteger #{name}_table_len = #{entries.length};"
+  out.join("\n") + "\n"
+end
+
+if ARGV.length != 1
+  $stderr.puts "Usage: #{$0} File.config"
+  exit 1
+end
+
+print config_table(ARGV[0])